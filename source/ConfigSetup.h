@@ -24,6 +24,17 @@ EMP_BUILD_CONFIG(SymConfigBase,
     VALUE(SYM_HORIZ_TRANS_RES, double, 100, "How many resources required for symbiont non-lytic horizontal transmission"),
     VALUE(SYM_VERT_TRANS_RES, double, 0, "How many resources required for symbiont vertical transmission"),
     VALUE(GRID, bool, 0, "Do offspring get placed immediately next to parents on grid, same for symbiont spreading"),
+    VALUE(THREADS, int, 1, "Number of threads used to process each update of a grid world (GRID 1) and to compute the statistics of large worlds, 1 for single-threaded"),
+    VALUE(COUNTER_RNG, bool, 0, "Should each cell draw from its own random stream keyed by seed, update and cell, so that results do not depend on THREADS? 0 for no, 1 for yes"),
+    VALUE(SKIP_EMPTY_CELLS, bool, 0, "Should each update only visit the cells occupied at its start? Faster for sparse worlds, but gives different results for a seed. 0 for no, 1 for yes"),
+    VALUE(SYNCHRONOUS, bool, 0, "Should births, deaths and symbiont movement between cells be held back until every cell has been processed in an update? 0 for no, 1 for yes"),
+    VALUE(EVENT_DRIVEN, bool, 0, "Should cells only be processed in updates where something happens to them, skipping the updates in between? 0 for no, 1 for yes"),
+    VALUE(MEAN_FIELD, bool, 0, "Should a well-mixed world (GRID 0) be run as binned host and symbiont distributions instead of individual organisms? Fast but approximate, 0 for no, 1 for yes"),
+    VALUE(AGGREGATE_NO_MUT, bool, 0, "Should the no-mutation updates of a well-mixed default-mode world be run on counts of identical organisms instead of the organisms themselves? 0 for no, 1 for yes"),
+    VALUE(REPLICATES, int, 1, "Number of replicates of this configuration to run side by side in one process, seeded SEED, SEED+1, and so on, each writing its own files"),
+    VALUE(ARRAY_STORAGE, bool, 0, "Should default-mode organisms be kept in per-field arrays indexed by cell instead of as separate objects? Needs FREE_LIVING_SYMS 0, PHYLOGENY 0 and single-threaded fixed updates, 0 for no, 1 for yes"),
+    VALUE(HUGE_PAGES, int, 0, "Should the population arrays and organism storage be backed by huge pages? 0 for no, 1 for transparent huge pages, 2 for explicit huge pages (MAP_HUGETLB, falling back to transparent ones if none are reserved). Linux only"),
+    VALUE(NUMA_POLICY, int, 0, "How should the population arrays and organism storage be placed across the NUMA nodes of a multi-socket machine? 0 for local first-touch (each page on the node of the thread that first writes it), 1 for interleaved across all nodes. Linux only"),
     VALUE(SYM_INFECTION_CHANCE, double, 1, "The chance (between 0 and 1) that a sym will infect a parallel host on process"),
     VALUE(SYM_INFECTION_FAILURE_RATE, double, 0, "The chance (between 0 and 1) that a sym will be killed by the world while trying to infect a host"),
     VALUE(HOST_AGE_MAX, int, -1, "The maximum number of updates hosts are allowed to live, -1 for infinite"),
@@ -33,6 +44,8 @@ EMP_BUILD_CONFIG(SymConfigBase,
     VALUE(NO_MUT_UPDATES, int, 0, "How many updates should be run after the end of UPDATES with all mutation turned off?"),
     VALUE(FILE_PATH, std::string, "", "Output file path"),
     VALUE(FILE_NAME, std::string, "_data", "Root output file name"),
+    VALUE(MEMORY_REPORT, bool, 0, "Should the bytes taken up by the population, organisms by type, symbiont lists, data monitors and phylogenies be written to a MemoryReport file every DATA_INT updates and at the end of the run? 0 for no, 1 for yes"),
+    VALUE(STATS_SAMPLE, int, 0, "Number of cells to sample at random for the statistics in the data files, so that their cost does not grow with the world, 0 to go through every cell. Means then get standard errors in extra _se columns, and histogram counts are scaled up to the whole world"),
 
     GROUP(MUTATION, "Mutation"),
     VALUE(MUTATION_SIZE, double, 0.002, "Standard deviation of the distribution to mutate by"),
@@ -0,0 +1,95 @@
+#ifndef CONFIG_SNAPSHOT_H
+#define CONFIG_SNAPSHOT_H
+
+#include "ConfigSetup.h"
+
+/**
+ * A plain copy of the settings read for every organism in every update,
+ * taken when a world is set up (and again whenever the world changes its
+ * settings, as SetMutationZero does).
+ */
+struct ConfigSnapshot {
+  bool free_living_syms = false;
+  bool ectosymbiosis = false;
+  bool horiz_trans = false;
+  bool synchronous = false;
+  bool lysis = false;
+  double res_distribute = 0;
+  double free_sym_res_distribute = 0;
+  double host_repro_res = 0;
+  int host_age_max = -1;
+  int sym_age_max = -1;
+
+  /**
+   * Input: The configuration settings to copy.
+   *
+   * Output: The snapshot.
+   *
+   * Purpose: To take a snapshot of the settings as they stand.
+   */
+  static ConfigSnapshot Freeze(SymConfigBase & config) {
+    ConfigSnapshot snapshot;
+    snapshot.free_living_syms = config.FREE_LIVING_SYMS();
+    snapshot.ectosymbiosis = config.ECTOSYMBIOSIS();
+    snapshot.horiz_trans = config.HORIZ_TRANS();
+    snapshot.synchronous = config.SYNCHRONOUS();
+    snapshot.lysis = config.LYSIS();
+    snapshot.res_distribute = config.RES_DISTRIBUTE();
+    snapshot.free_sym_res_distribute = config.FREE_SYM_RES_DISTRIBUTE();
+    snapshot.host_repro_res = config.HOST_REPRO_RES();
+    snapshot.host_age_max = config.HOST_AGE_MAX();
+    snapshot.sym_age_max = config.SYM_AGE_MAX();
+    return snapshot;
+  }
+};
+
+/**
+ * The settings an update reads, taken straight from the configuration as it
+ * stands. This is what organisms use when they are processed on their own
+ * (as the tests do) or by a world that doesn't know their types.
+ */
+class LiveParams {
+private:
+  SymConfigBase & config;
+
+public:
+  LiveParams(SymConfigBase & _config) : config(_config) {}
+
+  bool FreeLivingSyms() const {return config.FREE_LIVING_SYMS();}
+  bool Ectosymbiosis() const {return config.ECTOSYMBIOSIS();}
+  bool HorizTrans() const {return config.HORIZ_TRANS();}
+  bool Synchronous() const {return config.SYNCHRONOUS();}
+  bool Lysis() const {return config.LYSIS();}
+  double ResDistribute() const {return config.RES_DISTRIBUTE();}
+  double FreeSymResDistribute() const {return config.FREE_SYM_RES_DISTRIBUTE();}
+  double HostReproRes() const {return config.HOST_REPRO_RES();}
+  int HostAgeMax() const {return config.HOST_AGE_MAX();}
+  int SymAgeMax() const {return config.SYM_AGE_MAX();}
+};
+
+/**
+ * The settings an update reads, taken from a world's snapshot, with the main
+ * feature switches fixed at compile time so that the code for the features
+ * that are off is compiled out. SymWorldT picks the instantiation that
+ * matches its snapshot.
+ */
+template <bool FREE_LIVING_SYMS, bool ECTOSYMBIOSIS, bool HORIZ_TRANS, bool SYNCHRONOUS>
+class FrozenParams {
+private:
+  const ConfigSnapshot & snapshot;
+
+public:
+  FrozenParams(const ConfigSnapshot & _snapshot) : snapshot(_snapshot) {}
+
+  static constexpr bool FreeLivingSyms() {return FREE_LIVING_SYMS;}
+  static constexpr bool Ectosymbiosis() {return ECTOSYMBIOSIS;}
+  static constexpr bool HorizTrans() {return HORIZ_TRANS;}
+  static constexpr bool Synchronous() {return SYNCHRONOUS;}
+  bool Lysis() const {return snapshot.lysis;}
+  double ResDistribute() const {return snapshot.res_distribute;}
+  double FreeSymResDistribute() const {return snapshot.free_sym_res_distribute;}
+  double HostReproRes() const {return snapshot.host_repro_res;}
+  int HostAgeMax() const {return snapshot.host_age_max;}
+  int SymAgeMax() const {return snapshot.sym_age_max;}
+};
+#endif
@@ -0,0 +1,225 @@
+#ifndef MEMORY_POLICY_H
+#define MEMORY_POLICY_H
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <string>
+
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+#define SYM_LINUX_MEMORY_POLICY
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/**
+ * How the memory for a world's large arrays (pop and the free-living layer)
+ * and for the organism pool's slabs is laid out. Huge pages cut down on TLB
+ * misses for big worlds, and interleaving pages across the NUMA nodes of a
+ * multi-socket machine spreads the memory traffic over all of them instead
+ * of sending it to the node that set the world up. The policy is a hint: it
+ * is applied where the system supports it and otherwise left out, and it
+ * never changes results. It is shared by the whole process, like the
+ * organism pool.
+ */
+class MemoryPolicy {
+public:
+  /**
+    *
+    * Purpose: Represents the settings of HUGE_PAGES and NUMA_POLICY.
+    *
+  */
+  static constexpr int HUGE_PAGES_OFF = 0;
+  static constexpr int HUGE_PAGES_TRANSPARENT = 1;
+  static constexpr int HUGE_PAGES_EXPLICIT = 2;
+  static constexpr int NUMA_FIRST_TOUCH = 0;
+  static constexpr int NUMA_INTERLEAVE = 1;
+
+  /**
+    *
+    * Purpose: Represents the size of a huge page, and of the chunks slabs
+    * are carved out of when a policy is set.
+    *
+  */
+  static constexpr size_t HUGE_PAGE_SIZE = size_t(2) << 20;
+  static constexpr size_t CHUNK_SIZE = 16 * HUGE_PAGE_SIZE;
+
+private:
+  static inline int huge_pages = HUGE_PAGES_OFF;
+  static inline int numa = NUMA_FIRST_TOUCH;
+
+  /**
+    *
+    * Purpose: Represents the chunk slabs are being carved out of, and how
+    * many chunks were mapped with explicit huge pages and without them.
+    *
+  */
+  static inline std::mutex chunk_mutex;
+  static inline char * chunk = nullptr;
+  static inline size_t chunk_left = 0;
+  static inline size_t explicit_chunks = 0;
+  static inline size_t other_chunks = 0;
+
+#ifdef SYM_LINUX_MEMORY_POLICY
+  /**
+   * Input: None
+   *
+   * Output: A mask of the machine's NUMA nodes, or 0 if it has only one.
+   *
+   * Purpose: To find the nodes to interleave pages across.
+   */
+  static unsigned long GetNodeMask() {
+    static unsigned long mask = [](){
+      unsigned long found = 0;
+      for (size_t node = 0; node < 8 * sizeof(unsigned long); node++) {
+        std::string path = "/sys/devices/system/node/node" + std::to_string(node);
+        if (access(path.c_str(), F_OK) == 0) found |= 1ul << node;
+      }
+      return (found & (found - 1)) ? found : 0ul;
+    }();
+    return mask;
+  }
+
+  /**
+   * Input: The start of a range of pages, and its length in bytes.
+   *
+   * Output: None
+   *
+   * Purpose: To interleave a range across the NUMA nodes, moving the pages
+   * that are already in use. mbind is called directly, so the build doesn't
+   * need libnuma.
+   */
+  static void Interleave(void * start, size_t bytes) {
+    unsigned long mask = GetNodeMask();
+    if (!mask) return;
+    const int MPOL_INTERLEAVE_MODE = 3;
+    const unsigned MPOL_MF_MOVE_FLAG = 1 << 1;
+    syscall(SYS_mbind, start, bytes, MPOL_INTERLEAVE_MODE, &mask, 8 * sizeof(mask), MPOL_MF_MOVE_FLAG);
+  }
+
+  /**
+   * Input: The number of bytes wanted, a multiple of HUGE_PAGE_SIZE.
+   *
+   * Output: A fresh, untouched range of that many bytes aligned to a huge page.
+   *
+   * Purpose: To map a chunk with the policy applied before any of its pages
+   * are touched. Explicit huge pages fall back to transparent ones when the
+   * system has none reserved.
+   */
+  static void * MapChunk(size_t bytes) {
+    if (huge_pages == HUGE_PAGES_EXPLICIT) {
+      void * mapped = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      if (mapped != MAP_FAILED) {
+        explicit_chunks++;
+        if (numa == NUMA_INTERLEAVE) Interleave(mapped, bytes);
+        return mapped;
+      }
+    }
+    void * mapped = mmap(nullptr, bytes + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapped == MAP_FAILED) throw std::bad_alloc();
+    char * aligned = (char *) (((size_t) mapped + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1));
+    other_chunks++;
+    Advise(aligned, bytes);
+    return aligned;
+  }
+#endif
+
+public:
+  /**
+   * Input: The HUGE_PAGES and NUMA_POLICY settings.
+   *
+   * Output: None
+   *
+   * Purpose: To set the policy for the arrays and slabs allocated from now on.
+   */
+  static void Set(int _huge_pages, int _numa) {
+    huge_pages = _huge_pages;
+    numa = _numa;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: Whether no policy is set, so memory is allocated as usual.
+   *
+   * Purpose: To check whether there is anything to apply.
+   */
+  static bool IsDefault() {return huge_pages == HUGE_PAGES_OFF && numa == NUMA_FIRST_TOUCH;}
+
+  static size_t GetExplicitChunks() {return explicit_chunks;}
+  static size_t GetOtherChunks() {return other_chunks;}
+
+  /**
+   * Input: The start of a buffer and its length in bytes.
+   *
+   * Output: None
+   *
+   * Purpose: To apply the policy to memory that is already allocated: the
+   * whole pages in it are marked for transparent huge pages and/or
+   * interleaved. Pages that have not been touched yet get the policy when
+   * they are, so this is best called before a buffer is filled in.
+   */
+  static void Advise(void * data, size_t bytes) {
+#ifdef SYM_LINUX_MEMORY_POLICY
+    if (IsDefault() || !data) return;
+    size_t page = (size_t) sysconf(_SC_PAGESIZE);
+    size_t start = ((size_t) data + page - 1) & ~(page - 1);
+    size_t end = ((size_t) data + bytes) & ~(page - 1);
+    if (end <= start) return;
+    if (huge_pages != HUGE_PAGES_OFF) madvise((void *) start, end - start, MADV_HUGEPAGE);
+    if (numa == NUMA_INTERLEAVE) Interleave((void *) start, end - start);
+#endif
+  }
+
+  /**
+   * Input: A vector and the number of elements it is about to hold.
+   *
+   * Output: None
+   *
+   * Purpose: To grow a vector before it is filled in, so that its new buffer
+   * gets the policy before its pages are first touched. Without a policy
+   * the vector is left to grow as it would have.
+   */
+  template <typename VECTOR>
+  static void Reserve(VECTOR & vec, size_t new_size) {
+    if (IsDefault() || new_size <= vec.capacity()) return;
+    vec.reserve(std::max(new_size, 2 * vec.capacity()));
+    Advise(vec.data(), vec.capacity() * sizeof(typename VECTOR::value_type));
+  }
+
+  /**
+   * Input: The size of a slab of the organism pool.
+   *
+   * Output: Storage for the slab.
+   *
+   * Purpose: To allocate a slab. Without a policy it comes from the global
+   * allocator; with one it is carved out of a chunk mapped with the policy.
+   * Slabs are never freed.
+   */
+  static void * AllocateSlab(size_t bytes) {
+#ifdef SYM_LINUX_MEMORY_POLICY
+    if (!IsDefault()) {
+      const size_t ALIGN = 64;
+      bytes = (bytes + ALIGN - 1) & ~(ALIGN - 1);
+      std::unique_lock<std::mutex> lock(chunk_mutex);
+      if (bytes > CHUNK_SIZE) {
+        return MapChunk((bytes + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1));
+      }
+      if (bytes > chunk_left) {
+        chunk = (char *) MapChunk(CHUNK_SIZE);
+        chunk_left = CHUNK_SIZE;
+      }
+      void * slab = chunk;
+      chunk += bytes;
+      chunk_left -= bytes;
+      return slab;
+    }
+#endif
+    return ::operator new(bytes);
+  }
+};
+#endif
@@ -0,0 +1,119 @@
+#ifndef MEMORY_REPORT_H
+#define MEMORY_REPORT_H
+
+#include "../Empirical/include/emp/base/vector.hpp"
+#include <ostream>
+#include <string>
+
+/**
+ * An account of the memory a world's structures take up: for each structure
+ * (the population vectors, each exact type of organism, the symbiont lists,
+ * the data monitors and the phylogenies), how many items it holds and how
+ * many bytes they take up. Structures keep the order they were first added
+ * in, so reports of the same world line up.
+ */
+class MemoryReport {
+public:
+  /**
+    *
+    * Purpose: Represents one structure of the report.
+    *
+  */
+  struct Entry {
+    std::string name;
+    size_t count = 0;
+    size_t bytes = 0;
+  };
+
+private:
+  emp::vector<Entry> entries;
+
+public:
+  /**
+   * Input: The name of a structure, and the items and bytes to add to it.
+   *
+   * Output: None
+   *
+   * Purpose: To account for part of a structure, adding the structure to
+   * the report if it isn't there yet.
+   */
+  void Add(const std::string & name, size_t count, size_t bytes) {
+    for (Entry & entry : entries) {
+      if (entry.name != name) continue;
+      entry.count += count;
+      entry.bytes += bytes;
+      return;
+    }
+    entries.push_back({name, count, bytes});
+  }
+
+  const emp::vector<Entry> & GetEntries() const {return entries;}
+
+  /**
+   * Input: The name of a structure.
+   *
+   * Output: The number of items it holds, or 0 if it isn't in the report.
+   *
+   * Purpose: To look up a structure's size.
+   */
+  size_t GetCount(const std::string & name) const {
+    for (const Entry & entry : entries) {
+      if (entry.name == name) return entry.count;
+    }
+    return 0;
+  }
+
+  /**
+   * Input: The name of a structure.
+   *
+   * Output: The bytes it takes up, or 0 if it isn't in the report.
+   *
+   * Purpose: To look up a structure's memory.
+   */
+  size_t GetBytes(const std::string & name) const {
+    for (const Entry & entry : entries) {
+      if (entry.name == name) return entry.bytes;
+    }
+    return 0;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The bytes all the structures take up.
+   *
+   * Purpose: To total up the report.
+   */
+  size_t GetTotalBytes() const {
+    size_t total = 0;
+    for (const Entry & entry : entries) total += entry.bytes;
+    return total;
+  }
+
+  /**
+   * Input: The stream to write to.
+   *
+   * Output: None
+   *
+   * Purpose: To write the column names of the rows Write writes.
+   */
+  static void WriteHeader(std::ostream & os) {
+    os << "update,structure,count,bytes\n";
+  }
+
+  /**
+   * Input: The stream to write to, and the update the report was taken at.
+   *
+   * Output: None
+   *
+   * Purpose: To write the report as one row per structure, followed by a
+   * "total" row.
+   */
+  void Write(std::ostream & os, size_t update) const {
+    for (const Entry & entry : entries) {
+      os << update << "," << entry.name << "," << entry.count << "," << entry.bytes << "\n";
+    }
+    os << update << ",total,," << GetTotalBytes() << "\n";
+  }
+};
+#endif
@@ -2,7 +2,23 @@
 #define ORGANISM_H
 
 #include <string>
+#include <type_traits>
 #include "ConfigSetup.h"
+#include "OrganismPool.h"
+#include "OrganismContext.h"
+#include "ConfigSnapshot.h"
+#include "SmallVector.h"
+#include "TraitValue.h"
+
+class Organism;
+
+/**
+ *
+ * Purpose: Represents the symbionts a host carries. The first few live inside
+ * the host itself, so most hosts never allocate for their symbionts.
+ *
+ */
+using SymbiontList = SmallVector<emp::Ptr<Organism>, 4>;
 
 class Organism {
 
@@ -17,9 +33,23 @@ class Organism {
   bool operator==(const Organism &other) const {return (this == &other);}
   bool operator!=(const Organism &other) const {return !(*this == other);}
 
+  /**
+   * Input: The size of the organism (of whichever type) being made or freed.
+   *
+   * Output: The storage for it, when being made.
+   *
+   * Purpose: To take the storage for every organism from OrganismPool, so that
+   * births reuse the slots of dead organisms instead of going to malloc.
+   */
+  static void * operator new(size_t size) {return OrganismPool::Allocate(size);}
+  static void operator delete(void * ptr, size_t size) {OrganismPool::Release(ptr, size);}
+
   virtual std::string const GetName() {
     std::cout << "GetName called from Organism" << std::endl;
     throw "Organism method called!";}
+  virtual size_t GetObjectSize() {
+    std::cout << "GetObjectSize called from Organism" << std::endl;
+    throw "Organism method called!";}
 
   virtual double GetIntVal() const {
     std::cout << "GetIntVal called from Organsim" << std::endl;
@@ -132,10 +162,10 @@ class Organism {
 
   //Host functions
 
-  virtual emp::vector<emp::Ptr<Organism>>& GetSymbionts() {
+  virtual SymbiontList& GetSymbionts() {
     std::cout << "GetSymbionts called from Organism" << std::endl;
     throw "Organism method called!";}
-  virtual emp::vector<emp::Ptr<Organism>>& GetReproSymbionts() {
+  virtual SymbiontList& GetReproSymbionts() {
     std::cout << "GetReproSymbionts called from Organism" << std::endl;
     throw "Organism method called!";}
   virtual void SetResInProcess(double _in){
@@ -162,6 +192,12 @@ class Organism {
   virtual bool IsHost() {
     std::cout << "IsHost called from Organism" << std::endl;
     throw "Organism method called!";}
+  virtual bool IsInWorld() {
+    std::cout << "IsInWorld called from Organism" << std::endl;
+    throw "Organism method called!";}
+  virtual void SetInWorld(bool _in) {
+    std::cout << "SetInWorld called from Organism" << std::endl;
+    throw "Organism method called!";}
   virtual void DistribResources(double resources) {
     std::cout << "DistribResources called from Organism" << std::endl;
     throw "Organism method called!";}
@@ -212,6 +248,9 @@ class Organism {
   virtual bool GetLysogeny() {
     std::cout << "GetLysogeny called from Organism" << std::endl;
     throw "Organism method called!";}
+  virtual void SetLysogeny(bool _in) {
+    std::cout << "SetLysogeny called from Organism" << std::endl;
+    throw "Organism method called!";}
 
   //Public goods game host functions
   virtual void SetPool(double _in) {
@@ -235,4 +274,21 @@ class Organism {
     throw "Organism method called!";}
 
 };
+
+/**
+ * Input: The organism to process, as a pointer to its exact type (or to
+ * Organism, if its exact type isn't known), its position, and the settings
+ * to process it with (see ConfigSnapshot.h).
+ *
+ * Output: None
+ *
+ * Purpose: To process an organism. When its exact type is known, the call
+ * is bound at compile time, so that it can be inlined, rather than going
+ * through the organism's vtable.
+ */
+template <typename ORG, typename PARAMS>
+void ProcessAs(emp::Ptr<ORG> org, emp::WorldPosition pos, const PARAMS & params) {
+  if constexpr (std::is_same<ORG, Organism>::value) org->Process(pos);
+  else org->ProcessWith(pos, params);
+}
 #endif
@@ -0,0 +1,57 @@
+#ifndef ORGANISM_CONTEXT_H
+#define ORGANISM_CONTEXT_H
+
+#include "../Empirical/include/emp/base/Ptr.hpp"
+#include "../Empirical/include/emp/math/Random.hpp"
+#include "ConfigSetup.h"
+#include <deque>
+#include <map>
+#include <mutex>
+#include <tuple>
+
+class SymWorld;
+
+/**
+ * The random number generator, world and config that organisms live in.
+ * Organisms of the same world share a single context rather than each
+ * holding its own copy of these pointers.
+ */
+struct OrganismContext {
+  emp::Ptr<emp::Random> random = nullptr;
+  emp::Ptr<SymWorld> world = nullptr;
+  emp::Ptr<SymConfigBase> config = nullptr;
+
+  /**
+   * Input: The random number generator, world and config an organism is
+   * being made with.
+   *
+   * Output: The context shared by every organism made with them.
+   *
+   * Purpose: To look up (or create, the first time it is asked for) the
+   * shared context. Each thread remembers the last context it was given,
+   * so organisms being born into the same world find it without locking.
+   */
+  static emp::Ptr<OrganismContext> Get(emp::Ptr<emp::Random> _random, emp::Ptr<SymWorld> _world,
+    emp::Ptr<SymConfigBase> _config) {
+    static thread_local OrganismContext * last = nullptr;
+    if (last && last->random == _random && last->world == _world && last->config == _config) {
+      return last;
+    }
+
+    //contexts are kept for the life of the program, since they are only a few
+    //pointers and organisms can outlive the worlds they were made in
+    static std::mutex mutex;
+    static std::deque<OrganismContext> contexts;
+    static std::map<std::tuple<void *, void *, void *>, OrganismContext *> index;
+    std::unique_lock<std::mutex> lock(mutex);
+    std::tuple<void *, void *, void *> key(_random.Raw(), _world.Raw(), _config.Raw());
+    auto found = index.find(key);
+    if (found == index.end()) {
+      contexts.push_back(OrganismContext{_random, _world, _config});
+      found = index.emplace(key, &contexts.back()).first;
+    }
+    last = found->second;
+    return last;
+  }
+};
+#endif
@@ -0,0 +1,310 @@
+#ifndef ORGANISM_POOL_H
+#define ORGANISM_POOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+#include "MemoryPolicy.h"
+
+class OrganismPool {
+public:
+  /**
+    *
+    * Purpose: Represents a snapshot of the pool: the organisms alive now,
+    * the allocations so far and how many of them reused a freed slot, and
+    * the slab slots carved out in total.
+    *
+  */
+  struct Stats {
+    size_t live = 0;
+    size_t allocations = 0;
+    size_t recycled = 0;
+    size_t slab_slots = 0;
+    size_t slab_bytes = 0;
+
+    double GetOccupancy() const {return slab_slots ? (double) live / slab_slots : 0.0;}
+    double GetRecycleRate() const {return allocations ? (double) recycled / allocations : 0.0;}
+  };
+
+  /**
+    *
+    * Purpose: Represents the slot sizes the pool serves (every multiple of
+    * SLOT_ALIGN up to MAX_SIZE; anything larger goes to the global allocator),
+    * the number of slots carved out of each new slab, and the number of free
+    * slots of a size class a thread may hold before it hands SLAB_SLOTS of
+    * them back to the shared free list.
+    *
+  */
+  static constexpr size_t SLOT_ALIGN = alignof(std::max_align_t);
+  static constexpr size_t MAX_SIZE = 512;
+  static constexpr size_t NUM_CLASSES = MAX_SIZE / SLOT_ALIGN;
+  static constexpr size_t SLAB_SLOTS = 256;
+  static constexpr size_t CACHE_SLOTS = 2 * SLAB_SLOTS;
+
+private:
+  /**
+    *
+    * Purpose: Represents a linked list of free slots of one size class,
+    * passed between the threads and the shared free list as a whole.
+    *
+  */
+  struct Batch {
+    void * head = nullptr;
+    size_t count = 0;
+  };
+
+  /**
+    *
+    * Purpose: Represents a thread's free slots for each size class, and its
+    * counts. Each thread allocates from and frees into its own lists without
+    * locking; the counts are only summed up when stats are asked for.
+    *
+  */
+  struct ThreadCache {
+    void * free_lists[NUM_CLASSES] = {};
+    size_t free_counts[NUM_CLASSES] = {};
+    std::atomic<size_t> allocations{0};
+    std::atomic<size_t> recycled{0};
+    std::atomic<size_t> releases{0};
+
+    ThreadCache() {
+      std::unique_lock<std::mutex> lock(GetState().mutex);
+      GetState().caches.push_back(this);
+    }
+
+    ~ThreadCache() {
+      retired = true;
+      State & state = GetState();
+      std::unique_lock<std::mutex> lock(state.mutex);
+      for (size_t c = 0; c < NUM_CLASSES; c++) {
+        if (free_counts[c]) state.free_batches[c].push_back({free_lists[c], free_counts[c]});
+        free_lists[c] = nullptr;
+        free_counts[c] = 0;
+      }
+      state.retired_allocations += allocations;
+      state.retired_recycled += recycled;
+      state.retired_releases += releases;
+      for (size_t i = 0; i < state.caches.size(); i++) {
+        if (state.caches[i] == this) {
+          state.caches[i] = state.caches.back();
+          state.caches.pop_back();
+          break;
+        }
+      }
+    }
+  };
+
+  /**
+    *
+    * Purpose: Represents what the threads share: the slabs, the free slots
+    * handed back by threads that held too many or have finished, the live
+    * thread caches, and the counts of finished threads.
+    *
+  */
+  struct State {
+    std::mutex mutex;
+    std::vector<void *> slabs;
+    std::vector<Batch> free_batches[NUM_CLASSES];
+    std::vector<ThreadCache *> caches;
+    size_t slab_slots = 0;
+    size_t slab_bytes = 0;
+    size_t retired_allocations = 0;
+    size_t retired_recycled = 0;
+    size_t retired_releases = 0;
+  };
+
+  /**
+   * Input: None
+   *
+   * Output: The shared state.
+   *
+   * Purpose: To get the shared state. It is never destroyed, so organisms
+   * freed during program shutdown still have somewhere to go.
+   */
+  static State & GetState() {
+    static State * state = new State();
+    return *state;
+  }
+
+  /**
+    *
+    * Purpose: Represents whether the calling thread's cache has been
+    * destroyed (organisms can still be freed while a thread shuts down).
+    *
+  */
+  static inline thread_local bool retired = false;
+
+  /**
+   * Input: None
+   *
+   * Output: The calling thread's cache, or nullptr if it has been destroyed.
+   *
+   * Purpose: To get the calling thread's cache.
+   */
+  static ThreadCache * GetCache() {
+    if (retired) return nullptr;
+    static thread_local ThreadCache cache;
+    return &cache;
+  }
+
+  /**
+   * Input: The size class that has run out of free slots.
+   *
+   * Output: A free slot.
+   *
+   * Purpose: To refill a thread's list for a size class, from the shared
+   * free list if it has slots, or from a new slab.
+   */
+  static void * Refill(ThreadCache & cache, size_t c) {
+    State & state = GetState();
+    std::unique_lock<std::mutex> lock(state.mutex);
+    if (state.free_batches[c].size() > 0) {
+      cache.free_lists[c] = state.free_batches[c].back().head;
+      cache.free_counts[c] = state.free_batches[c].back().count;
+      state.free_batches[c].pop_back();
+      cache.recycled.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      size_t slot_size = (c + 1) * SLOT_ALIGN;
+      char * slab = (char *) MemoryPolicy::AllocateSlab(slot_size * SLAB_SLOTS);
+      state.slabs.push_back(slab);
+      state.slab_slots += SLAB_SLOTS;
+      state.slab_bytes += slot_size * SLAB_SLOTS;
+      for (size_t i = SLAB_SLOTS; i > 0; i--) {
+        void * slot = slab + (i - 1) * slot_size;
+        *(void **) slot = cache.free_lists[c];
+        cache.free_lists[c] = slot;
+      }
+      cache.free_counts[c] = SLAB_SLOTS;
+    }
+    void * slot = cache.free_lists[c];
+    cache.free_lists[c] = *(void **) slot;
+    cache.free_counts[c]--;
+    return slot;
+  }
+
+  /**
+   * Input: The thread's cache and a size class it holds too many free slots of.
+   *
+   * Output: None
+   *
+   * Purpose: To hand SLAB_SLOTS of a thread's free slots back to the shared
+   * free list, so that slots freed on one thread (e.g. when a world is
+   * destroyed) can be reused by the others instead of new slabs.
+   */
+  static void Spill(ThreadCache & cache, size_t c) {
+    Batch batch = {cache.free_lists[c], SLAB_SLOTS};
+    void * last = batch.head;
+    for (size_t i = 1; i < SLAB_SLOTS; i++) last = *(void **) last;
+    cache.free_lists[c] = *(void **) last;
+    cache.free_counts[c] -= SLAB_SLOTS;
+    *(void **) last = nullptr;
+
+    State & state = GetState();
+    std::unique_lock<std::mutex> lock(state.mutex);
+    state.free_batches[c].push_back(batch);
+  }
+
+  /**
+   * Input: The size class wanted.
+   *
+   * Output: A slot.
+   *
+   * Purpose: To hand out a slot to a thread whose cache has been destroyed,
+   * straight from the shared state.
+   */
+  static void * AllocateShared(size_t c) {
+    State & state = GetState();
+    std::unique_lock<std::mutex> lock(state.mutex);
+    state.retired_allocations++;
+    if (state.free_batches[c].size() == 0) return ::operator new((c + 1) * SLOT_ALIGN);
+    Batch & batch = state.free_batches[c].back();
+    void * slot = batch.head;
+    batch.head = *(void **) slot;
+    if (--batch.count == 0) state.free_batches[c].pop_back();
+    state.retired_recycled++;
+    return slot;
+  }
+
+public:
+  /**
+   * Input: The size of the organism being made.
+   *
+   * Output: Storage for it.
+   *
+   * Purpose: To hand out storage for a new organism, reusing the storage of
+   * a dead one of the same size class when there is one.
+   */
+  static void * Allocate(size_t size) {
+    if (size > MAX_SIZE) return ::operator new(size);
+    size_t c = (size - 1) / SLOT_ALIGN;
+    ThreadCache * cache = GetCache();
+    if (!cache) return AllocateShared(c);
+    cache->allocations.fetch_add(1, std::memory_order_relaxed);
+    void * slot = cache->free_lists[c];
+    if (!slot) return Refill(*cache, c);
+    cache->free_lists[c] = *(void **) slot;
+    cache->free_counts[c]--;
+    cache->recycled.fetch_add(1, std::memory_order_relaxed);
+    return slot;
+  }
+
+  /**
+   * Input: The storage of a dead organism and the organism's size.
+   *
+   * Output: None
+   *
+   * Purpose: To take back a dead organism's storage for the next birth.
+   */
+  static void Release(void * ptr, size_t size) {
+    if (!ptr) return;
+    if (size > MAX_SIZE) {
+      ::operator delete(ptr);
+      return;
+    }
+    size_t c = (size - 1) / SLOT_ALIGN;
+    ThreadCache * cache = GetCache();
+    if (!cache) {
+      State & state = GetState();
+      std::unique_lock<std::mutex> lock(state.mutex);
+      state.retired_releases++;
+      std::vector<Batch> & batches = state.free_batches[c];
+      if (batches.size() == 0 || batches.back().count >= SLAB_SLOTS) batches.push_back(Batch());
+      *(void **) ptr = batches.back().head;
+      batches.back().head = ptr;
+      batches.back().count++;
+      return;
+    }
+    cache->releases.fetch_add(1, std::memory_order_relaxed);
+    *(void **) ptr = cache->free_lists[c];
+    cache->free_lists[c] = ptr;
+    if (++cache->free_counts[c] >= CACHE_SLOTS) Spill(*cache, c);
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The current stats, summed over every thread.
+   *
+   * Purpose: To report how the pool is being used.
+   */
+  static Stats GetStats() {
+    State & state = GetState();
+    std::unique_lock<std::mutex> lock(state.mutex);
+    Stats stats;
+    size_t releases = state.retired_releases;
+    stats.allocations = state.retired_allocations;
+    stats.recycled = state.retired_recycled;
+    for (ThreadCache * cache : state.caches) {
+      stats.allocations += cache->allocations.load(std::memory_order_relaxed);
+      stats.recycled += cache->recycled.load(std::memory_order_relaxed);
+      releases += cache->releases.load(std::memory_order_relaxed);
+    }
+    stats.live = stats.allocations > releases ? stats.allocations - releases : 0;
+    stats.slab_slots = state.slab_slots;
+    stats.slab_bytes = state.slab_bytes;
+    return stats;
+  }
+};
+#endif
@@ -0,0 +1,211 @@
+#ifndef SMALL_VECTOR_H
+#define SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/**
+ * A vector that keeps its first N elements inside the object itself and only
+ * moves them to the heap once there are more. It has the parts of the
+ * std::vector interface that symbiont lists use, and converts to and compares
+ * with any vector of the same elements.
+ */
+template <typename T, size_t N>
+class SmallVector {
+private:
+  /**
+    *
+    * Purpose: Represents the elements: inline_data while they fit, or a heap
+    * buffer of capacity elements once they don't. data_ptr points at whichever
+    * is in use.
+    *
+  */
+  T inline_data[N];
+  T * data_ptr = inline_data;
+  size_t count = 0;
+  size_t capacity = N;
+
+  bool IsInline() const {return data_ptr == inline_data;}
+
+  /**
+   * Input: The number of elements that must fit.
+   *
+   * Output: None
+   *
+   * Purpose: To move the elements to a larger heap buffer if they don't fit.
+   */
+  void Grow(size_t needed) {
+    if (needed <= capacity) return;
+    size_t new_capacity = std::max(needed, capacity * 2);
+    T * new_data = new T[new_capacity];
+    std::move(data_ptr, data_ptr + count, new_data);
+    if (!IsInline()) delete [] data_ptr;
+    data_ptr = new_data;
+    capacity = new_capacity;
+  }
+
+public:
+  using value_type = T;
+  using iterator = T *;
+  using const_iterator = const T *;
+
+  SmallVector() = default;
+  SmallVector(std::initializer_list<T> in) {
+    Grow(in.size());
+    for (const T & value : in) data_ptr[count++] = value;
+  }
+
+  /**
+   * Input: Any container of the same elements (such as an emp::vector).
+   *
+   * Output: None
+   *
+   * Purpose: To copy the elements of another container.
+   */
+  template <typename CONTAINER,
+    typename = std::enable_if_t<std::is_same<typename CONTAINER::value_type, T>::value>>
+  SmallVector(const CONTAINER & in) {
+    Grow(in.size());
+    for (const T & value : in) data_ptr[count++] = value;
+  }
+
+  SmallVector(const SmallVector & in) {
+    Grow(in.count);
+    std::copy(in.begin(), in.end(), data_ptr);
+    count = in.count;
+  }
+
+  SmallVector(SmallVector && in) {
+    if (in.IsInline()) {
+      std::move(in.begin(), in.end(), data_ptr);
+    } else {
+      data_ptr = in.data_ptr;
+      capacity = in.capacity;
+      in.data_ptr = in.inline_data;
+      in.capacity = N;
+    }
+    count = in.count;
+    in.count = 0;
+  }
+
+  SmallVector & operator=(const SmallVector & in) {
+    if (this == &in) return *this;
+    count = 0;
+    Grow(in.count);
+    std::copy(in.begin(), in.end(), data_ptr);
+    count = in.count;
+    return *this;
+  }
+
+  SmallVector & operator=(SmallVector && in) {
+    if (this == &in) return *this;
+    if (!IsInline()) delete [] data_ptr;
+    data_ptr = inline_data;
+    capacity = N;
+    if (in.IsInline()) {
+      std::move(in.begin(), in.end(), data_ptr);
+    } else {
+      data_ptr = in.data_ptr;
+      capacity = in.capacity;
+      in.data_ptr = in.inline_data;
+      in.capacity = N;
+    }
+    count = in.count;
+    in.count = 0;
+    return *this;
+  }
+
+  ~SmallVector() {
+    if (!IsInline()) delete [] data_ptr;
+  }
+
+  size_t size() const {return count;}
+  bool empty() const {return count == 0;}
+  T * data() {return data_ptr;}
+  const T * data() const {return data_ptr;}
+
+  iterator begin() {return data_ptr;}
+  iterator end() {return data_ptr + count;}
+  const_iterator begin() const {return data_ptr;}
+  const_iterator end() const {return data_ptr + count;}
+
+  T & operator[](size_t i) {return data_ptr[i];}
+  const T & operator[](size_t i) const {return data_ptr[i];}
+  T & at(size_t i) {
+    if (i >= count) throw std::out_of_range("SmallVector::at");
+    return data_ptr[i];
+  }
+  const T & at(size_t i) const {
+    if (i >= count) throw std::out_of_range("SmallVector::at");
+    return data_ptr[i];
+  }
+  T & front() {return data_ptr[0];}
+  T & back() {return data_ptr[count - 1];}
+
+  void push_back(const T & value) {
+    if (count == capacity) {
+      T copy = value; //value may live in the buffer that is about to move
+      Grow(count + 1);
+      data_ptr[count++] = copy;
+      return;
+    }
+    data_ptr[count++] = value;
+  }
+  void pop_back() {data_ptr[--count] = T();}
+
+  iterator erase(iterator pos) {
+    std::move(pos + 1, end(), pos);
+    data_ptr[--count] = T();
+    return pos;
+  }
+  iterator erase(iterator first, iterator last) {
+    iterator new_end = std::move(last, end(), first);
+    for (iterator it = new_end; it != end(); ++it) *it = T();
+    count = new_end - data_ptr;
+    return first;
+  }
+
+  void resize(size_t new_size) {
+    Grow(new_size);
+    for (size_t i = new_size; i < count; i++) data_ptr[i] = T();
+    count = new_size;
+  }
+  void clear() {resize(0);}
+  void reserve(size_t new_capacity) {Grow(new_capacity);}
+
+  /**
+   * Input: None
+   *
+   * Output: The bytes of heap buffer the elements take up, or 0 while they
+   * are kept inline.
+   *
+   * Purpose: To account for the memory a list takes up beyond its own object.
+   */
+  size_t GetHeapBytes() const {return IsInline() ? 0 : capacity * sizeof(T);}
+
+  /**
+   * Input: None
+   *
+   * Output: A copy of the elements in another kind of vector.
+   *
+   * Purpose: To let a SmallVector be used where a vector (such as an
+   * emp::vector) of the same elements is wanted.
+   */
+  template <typename CONTAINER,
+    typename = std::enable_if_t<std::is_same<typename CONTAINER::value_type, T>::value>>
+  operator CONTAINER() const {return CONTAINER(begin(), end());}
+
+  template <typename CONTAINER>
+  bool operator==(const CONTAINER & other) const {
+    return count == other.size() && std::equal(begin(), end(), other.begin());
+  }
+  template <typename CONTAINER>
+  bool operator!=(const CONTAINER & other) const {return !(*this == other);}
+
+  friend size_t size(const SmallVector & v) {return v.size();}
+};
+#endif
@@ -0,0 +1,64 @@
+#ifndef TRAIT_VALUE_H
+#define TRAIT_VALUE_H
+
+#include <cmath>
+#include <cstdint>
+
+/**
+ * A trait value held in 16 bits: a fixed point number covering [-1, 1] in
+ * steps of 1/32767. Values outside that range are clamped when stored. It
+ * reads as a double, so it can be used wherever the trait was a double.
+ */
+class Fixed16Trait {
+private:
+  int16_t raw = 0;
+
+  static constexpr double SCALE = 32767.0;
+
+  /**
+   * Input: The value to store.
+   *
+   * Output: The nearest 16 bit step to the value, clamped to [-1, 1].
+   *
+   * Purpose: To convert a value to its stored form.
+   */
+  static int16_t Encode(double value) {
+    if (value >= 1) return (int16_t) SCALE;
+    if (value <= -1) return (int16_t) -SCALE;
+    return (int16_t) std::lround(value * SCALE);
+  }
+
+public:
+  Fixed16Trait() = default;
+  Fixed16Trait(double value) : raw(Encode(value)) {}
+
+  operator double() const {return raw / SCALE;}
+
+  Fixed16Trait & operator+=(double change) {
+    raw = Encode(raw / SCALE + change);
+    return *this;
+  }
+  Fixed16Trait & operator-=(double change) {
+    raw = Encode(raw / SCALE - change);
+    return *this;
+  }
+};
+
+/**
+ *
+ * Purpose: Represents the type that evolving traits (interaction values,
+ * infection chances, efficiencies, donations, lysis and induction chances
+ * and incorporation values) are stored in. They are doubles unless the
+ * build defines SYM_TRAIT_FLOAT or SYM_TRAIT_FIXED16, which trade precision
+ * for smaller organisms. Traits are still read and mutated as doubles.
+ *
+ */
+#if defined(SYM_TRAIT_FIXED16)
+using trait_t = Fixed16Trait;
+#elif defined(SYM_TRAIT_FLOAT)
+using trait_t = float;
+#else
+using trait_t = double;
+#endif
+
+#endif
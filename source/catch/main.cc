@@ -7,6 +7,11 @@
 
 #include "../test/default_mode_test/SymWorld.test.cc"
 #include "../test/default_mode_test/DataNodes.test.cc"
+#include "../test/default_mode_test/MeanFieldWorld.test.cc"
+#include "../test/default_mode_test/Ensemble.test.cc"
+#include "../test/default_mode_test/ArrayWorld.test.cc"
+#include "../test/default_mode_test/GenotypeCountWorld.test.cc"
+#include "../test/default_mode_test/TiledUpdate.test.cc"
 
 #include "../test/default_mode_test/Host.test.cc"
 #include "../test/default_mode_test/Symbiont.test.cc"
@@ -0,0 +1,77 @@
+#ifndef ACTIVE_CELLS_H
+#define ACTIVE_CELLS_H
+
+#include "../../Empirical/include/emp/base/vector.hpp"
+
+/**
+ * The compact list of a world's cells that hold a host and/or a free-living
+ * symbiont, and the position of each cell in that list. Cells are added and
+ * removed in constant time, so updates that skip empty cells
+ * (SKIP_EMPTY_CELLS) cost in proportion to the occupied cells rather than
+ * to the size of the world. The world says which cells may have gained or
+ * lost organisms (see SymWorld::UpdateActiveCell).
+ */
+class ActiveCells {
+public:
+  /**
+    *
+    * Purpose: Represents the position of a cell that is not in the list.
+    *
+  */
+  static constexpr size_t NOT_ACTIVE = (size_t) -1;
+
+private:
+  emp::vector<size_t> cells;
+  emp::vector<size_t> cell_pos;
+
+public:
+  /**
+   * Input: None
+   *
+   * Output: The number of cells tracked, active or not.
+   *
+   * Purpose: To check which cells the list knows about.
+   */
+  size_t GetNumCells() const {return cell_pos.size();}
+
+  /**
+   * Input: None
+   *
+   * Output: The active cells, in no particular order.
+   *
+   * Purpose: To get the list.
+   */
+  const emp::vector<size_t> & GetCells() const {return cells;}
+
+  /**
+   * Input: The number of cells to track.
+   *
+   * Output: None
+   *
+   * Purpose: To track more or fewer cells. Cells cut off must have been
+   * removed from the list first; cells added start out inactive.
+   */
+  void Resize(size_t num_cells) {cell_pos.resize(num_cells, NOT_ACTIVE);}
+
+  /**
+   * Input: The size_t location of a tracked cell, and whether it holds any organisms.
+   *
+   * Output: None
+   *
+   * Purpose: To add the cell to, or remove it from, the list. Cells are
+   * removed by swapping the last active cell into their place.
+   */
+  void Set(size_t i, bool is_active) {
+    if (is_active && cell_pos[i] == NOT_ACTIVE) {
+      cell_pos[i] = cells.size();
+      cells.push_back(i);
+    } else if (!is_active && cell_pos[i] != NOT_ACTIVE) {
+      size_t last_cell = cells.back();
+      cells[cell_pos[i]] = last_cell;
+      cell_pos[last_cell] = cell_pos[i];
+      cells.pop_back();
+      cell_pos[i] = NOT_ACTIVE;
+    }
+  }
+};
+#endif
@@ -0,0 +1,499 @@
+#ifndef ARRAY_WORLD_H
+#define ARRAY_WORLD_H
+
+#include "SymWorld.h"
+#include "Host.h"
+#include "Symbiont.h"
+
+/**
+ * The struct-of-arrays storage backend for default mode (ARRAY_STORAGE 1).
+ * Hosts and their symbionts are kept in per-field arrays indexed by cell and
+ * updated there; pop is only rebuilt from the arrays when the data files
+ * print (see CollectStats) and at the end of a run. SymWorld itself stays the
+ * organism-level world: the arrays, their update loop, and the order cells
+ * are visited in all live here.
+ */
+class ArrayWorld : public SymWorld {
+private:
+  /**
+    *
+    * Purpose: Represents the hosts, one entry per cell. host_alive marks the
+    * cells that hold a host; the other fields are only meaningful there.
+    *
+  */
+  emp::vector<char> host_alive;
+  emp::vector<trait_t> host_int_val;
+  emp::vector<double> host_points;
+  emp::vector<int> host_age;
+  emp::vector<char> host_dead;
+
+  /**
+    *
+    * Purpose: Represents the symbionts inside each host, in SYM_LIMIT slots
+    * per cell (slot k of cell i is at i * sym_limit + k). The first
+    * sym_count[i] slots are in use, in the order of the host's symbiont list.
+    *
+  */
+  size_t sym_limit = 1;
+  emp::vector<size_t> sym_count;
+  emp::vector<trait_t> sym_int_val;
+  emp::vector<trait_t> sym_infection_chance;
+  emp::vector<double> sym_points;
+  emp::vector<int> sym_age;
+  emp::vector<char> sym_dead;
+
+  /**
+    *
+    * Purpose: Represents the symbionts given to a host offspring by vertical
+    * transmission, before the offspring is placed.
+    *
+  */
+  emp::vector<trait_t> baby_sym_int_val;
+  emp::vector<trait_t> baby_sym_infection_chance;
+
+  /**
+    *
+    * Purpose: Represents whether the arrays hold the population. Until they
+    * do, the population is in pop, as in SymWorld.
+    *
+  */
+  bool loaded = false;
+
+  /**
+    *
+    * Purpose: Represents the generator handed to organisms rebuilt for the
+    * data files, so that building them never uses up draws from the world's
+    * generator.
+    *
+  */
+  emp::Random store_random;
+
+  /**
+    *
+    * Purpose: Represents the order in which cells are visited during an
+    * update, refilled in place every update.
+    *
+  */
+  emp::vector<size_t> cell_order;
+
+public:
+  ArrayWorld(emp::Random & _random, emp::Ptr<SymConfigBase> _config) : SymWorld(_random, _config), store_random(1) {}
+
+  /**
+   * Input: The config settings.
+   *
+   * Output: Whether the array storage can run a world with these settings.
+   *
+   * Purpose: To check for the settings the arrays don't model: free-living
+   * symbionts (and so ectosymbiosis), phylogenies, and the threaded,
+   * counter-based, skip-empty, synchronous and event-driven update modes.
+   */
+  static bool CanUseArrays(SymConfigBase & config) {
+    return !config.FREE_LIVING_SYMS() && !config.PHYLOGENY() && config.THREADS() <= 1 &&
+      !config.COUNTER_RNG() && !config.SKIP_EMPTY_CELLS() && !config.SYNCHRONOUS() && !config.EVENT_DRIVEN();
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: Whether the arrays currently hold the population.
+   *
+   * Purpose: To check whether LoadPopulation has run.
+   */
+  bool IsLoaded() {return loaded;}
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To move the population from pop into the arrays, deleting the
+   * organism objects.
+   */
+  void LoadPopulation() {
+    size_t num_cells = GetSize();
+    sym_limit = std::max(1, my_config->SYM_LIMIT());
+    host_alive.assign(num_cells, 0);
+    host_int_val.assign(num_cells, 0);
+    host_points.assign(num_cells, 0);
+    host_age.assign(num_cells, 0);
+    host_dead.assign(num_cells, 0);
+    sym_count.assign(num_cells, 0);
+    sym_int_val.assign(num_cells * sym_limit, 0);
+    sym_infection_chance.assign(num_cells * sym_limit, 0);
+    sym_points.assign(num_cells * sym_limit, 0);
+    sym_age.assign(num_cells * sym_limit, 0);
+    sym_dead.assign(num_cells * sym_limit, 0);
+
+    for (size_t i = 0; i < num_cells; i++) {
+      if (!IsOccupied(i)) continue;
+      emp::Ptr<Organism> host = pop[i];
+      if (host->GetName() != "Host" || host->GetReproSymbionts().size() > 0) {
+        throw "Array storage only holds default-mode hosts";
+      }
+      host_alive[i] = 1;
+      host_int_val[i] = host->GetIntVal();
+      host_points[i] = host->GetPoints();
+      host_age[i] = host->GetAge();
+      host_dead[i] = host->GetDead();
+      for (emp::Ptr<Organism> sym : host->GetSymbionts()) {
+        if (sym->GetName() != "Symbiont") throw "Array storage only holds default-mode symbionts";
+        if (sym_count[i] == sym_limit) break;
+        size_t slot = i * sym_limit + sym_count[i]++;
+        sym_int_val[slot] = sym->GetIntVal();
+        sym_infection_chance[slot] = sym->GetInfectionChance();
+        sym_points[slot] = sym->GetPoints();
+        sym_age[slot] = sym->GetAge();
+        sym_dead[slot] = sym->GetDead();
+      }
+      DoDeath(i);
+    }
+    loaded = true;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To rebuild pop from the arrays, so that the data files (and
+   * anything that looks at organisms) see the current population. The
+   * arrays keep holding the population.
+   */
+  void StorePopulation() {
+    for (size_t i = 0; i < host_alive.size(); i++) {
+      if (!host_alive[i]) {
+        if (IsOccupied(i)) DoDeath(i);
+        continue;
+      }
+      emp::Ptr<Host> host = emp::NewPtr<Host>(&store_random, this, my_config, host_int_val[i],
+        emp::vector<emp::Ptr<Organism>>(), emp::vector<emp::Ptr<Organism>>(), host_points[i]);
+      host->SetAge(host_age[i]);
+      for (size_t slot = i * sym_limit; slot < i * sym_limit + sym_count[i]; slot++) {
+        emp::Ptr<Symbiont> sym = emp::NewPtr<Symbiont>(&store_random, this, my_config, sym_int_val[slot], sym_points[slot]);
+        sym->SetInfectionChance(sym_infection_chance[slot]);
+        sym->SetAge(sym_age[slot]);
+        sym->SetHost(host);
+        host->GetSymbionts().push_back(sym);
+      }
+      AddOrgAt(host, i);
+    }
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To rebuild pop from the arrays just before the data monitors
+   * are recomputed, which is when a data file is about to print, so that
+   * the files report the population the arrays hold at that moment.
+   */
+  void CollectStats() override {
+    if (loaded) StorePopulation();
+    SymWorld::CollectStats();
+  }
+
+  /**
+   * Input: The number of symbionts a host already has.
+   *
+   * Output: Whether one more symbiont is let in.
+   *
+   * Purpose: To follow Host::SymAllowedIn for a host in the arrays.
+   */
+  bool SymAllowedIn(size_t num_syms) {
+    if (!my_config->PHAGE_EXCLUDE()) return true;
+    return GetRandom().GetUInt((int) pow(2.0, num_syms)) == 0;
+  }
+
+  /**
+   * Input: The interaction value of the parent symbiont.
+   *
+   * Output: The interaction value of its offspring.
+   *
+   * Purpose: To follow Symbiont::Reproduce (with Symbiont::Mutate) for a
+   * symbiont in the arrays, drawing the same random numbers.
+   */
+  double ReproduceSym(double int_val) {
+    if (my_config->SYM_INFECTION_CHANCE() == -2) GetRandom().GetDouble(0, 1); //drawn by the constructor
+    if (GetRandom().GetDouble(0.0, 1.0) <= my_config->MUTATION_RATE()) {
+      int_val += GetRandom().GetRandNormal(0.0, my_config->MUTATION_SIZE());
+      if (int_val < -1) int_val = -1;
+      else if (int_val > 1) int_val = 1;
+    }
+    return int_val;
+  }
+
+  /**
+   * Input: The interaction value of the parent host.
+   *
+   * Output: The interaction value of its offspring.
+   *
+   * Purpose: To follow Host::Reproduce (with Host::Mutate) for a host in the arrays.
+   */
+  double ReproduceHost(double int_val) {
+    double mutation_size = my_config->HOST_MUTATION_SIZE();
+    if (mutation_size == -1) mutation_size = my_config->MUTATION_SIZE();
+    double mutation_rate = my_config->HOST_MUTATION_RATE();
+    if (mutation_rate == -1) mutation_rate = my_config->MUTATION_RATE();
+
+    if (GetRandom().GetDouble(0.0, 1.0) <= mutation_rate) {
+      int_val += GetRandom().GetRandNormal(0.0, mutation_size);
+      if (int_val < -1) int_val = -1;
+      else if (int_val > 1) int_val = 1;
+    }
+    return int_val;
+  }
+
+  /**
+   * Input: The cell of the host and the resources it got.
+   *
+   * Output: None
+   *
+   * Purpose: To follow Host::DistribResources (with Host::DistribResToSym,
+   * Symbiont::ProcessResources and Host::StealResources) for a host in the
+   * arrays, doing the arithmetic in the same order.
+   */
+  void DistribResources(size_t i, double resources) {
+    double hostIntVal = host_int_val[i];
+    if (sym_count[i] == 0) {
+      if (hostIntVal >= 0) {
+        double spent = resources * hostIntVal;
+        host_points[i] += resources - spent;
+      } else {
+        double hostDefense = -1.0 * hostIntVal * resources;
+        host_points[i] += resources - hostDefense;
+      }
+      return;
+    }
+
+    double sym_piece = (double) resources / sym_count[i];
+    double synergy = my_config->SYNERGY();
+    for (size_t slot = i * sym_limit; slot < i * sym_limit + sym_count[i]; slot++) {
+      double hostDonation = 0;
+      double res_in_process = 0;
+      if (hostIntVal < 0) {
+        double hostDefense = hostIntVal * sym_piece * -1.0;
+        res_in_process = sym_piece - hostDefense;
+      } else {
+        hostDonation = hostIntVal * sym_piece;
+        res_in_process = sym_piece - hostDonation;
+      }
+
+      double sym_int_val_here = sym_int_val[slot];
+      double host_portion = 0;
+      if (sym_int_val_here < 0) {
+        double defense = hostIntVal > 0 ? 0 : hostIntVal;
+        double stolen = 0;
+        if (sym_int_val_here < defense) {
+          stolen = (defense - sym_int_val_here) * res_in_process;
+          res_in_process = res_in_process - stolen;
+        }
+        sym_points[slot] += stolen + hostDonation;
+      } else {
+        host_portion = hostDonation * sym_int_val_here;
+        sym_points[slot] += hostDonation - host_portion;
+      }
+      host_points[i] += host_portion * synergy + res_in_process;
+    }
+  }
+
+  /**
+   * Input: The cell the symbiont is born next to.
+   *
+   * Output: The cell of the host it reaches, or -1 if there is none.
+   *
+   * Purpose: To follow SymWorld::GetNeighborHost, with host_alive standing in for pop.
+   */
+  int GetNeighborHostCell(size_t id) {
+    for (int i = 0; i < 3; i++) {
+      emp::WorldPosition neighbor = GetRandomNeighborPos(id);
+      if (neighbor.IsValid() && host_alive[neighbor.GetIndex()]) return neighbor.GetIndex();
+    }
+    emp::vector<size_t> validNeighbors;
+    for (size_t i = 0; i < host_alive.size(); i++) {
+      if (host_alive[i] && IsNeighbor(emp::WorldPosition(id), emp::WorldPosition(i))) validNeighbors.push_back(i);
+    }
+    if (validNeighbors.empty()) return -1;
+    return validNeighbors[GetRandom().GetUInt(0, validNeighbors.size())];
+  }
+
+  /**
+   * Input: The cell and the symbiont's traits.
+   *
+   * Output: Whether the symbiont got in.
+   *
+   * Purpose: To follow Host::AddSymbiont for a host in the arrays.
+   */
+  bool AddSymbiont(size_t i, double int_val, double infection_chance) {
+    if (sym_count[i] >= (size_t) my_config->SYM_LIMIT() || !SymAllowedIn(sym_count[i])) return false;
+    size_t slot = i * sym_limit + sym_count[i]++;
+    sym_int_val[slot] = int_val;
+    sym_infection_chance[slot] = infection_chance;
+    sym_points[slot] = 0;
+    sym_age[slot] = 0;
+    sym_dead[slot] = 0;
+    return true;
+  }
+
+  /**
+   * Input: The cell and the slot of the symbiont to remove.
+   *
+   * Output: None
+   *
+   * Purpose: To take a symbiont out of its host, keeping the others in order.
+   */
+  void RemoveSymbiont(size_t i, size_t j) {
+    size_t first = i * sym_limit;
+    for (size_t k = j; k + 1 < sym_count[i]; k++) {
+      sym_int_val[first + k] = sym_int_val[first + k + 1];
+      sym_infection_chance[first + k] = sym_infection_chance[first + k + 1];
+      sym_points[first + k] = sym_points[first + k + 1];
+      sym_age[first + k] = sym_age[first + k + 1];
+      sym_dead[first + k] = sym_dead[first + k + 1];
+    }
+    sym_count[i]--;
+  }
+
+  /**
+   * Input: The cell the offspring lands in and its interaction value; its
+   * symbionts are in baby_sym_int_val and baby_sym_infection_chance.
+   *
+   * Output: None
+   *
+   * Purpose: To place a host offspring, replacing whatever host was in the cell.
+   */
+  void PlaceHost(size_t i, double int_val) {
+    host_alive[i] = 1;
+    host_int_val[i] = int_val;
+    host_points[i] = 0;
+    host_age[i] = 0;
+    host_dead[i] = 0;
+    sym_count[i] = 0;
+    for (size_t k = 0; k < baby_sym_int_val.size(); k++) {
+      size_t slot = i * sym_limit + sym_count[i]++;
+      sym_int_val[slot] = baby_sym_int_val[k];
+      sym_infection_chance[slot] = baby_sym_infection_chance[k];
+      sym_points[slot] = 0;
+      sym_age[slot] = 0;
+      sym_dead[slot] = 0;
+    }
+  }
+
+  /**
+   * Input: The cell of the host to process.
+   *
+   * Output: None
+   *
+   * Purpose: To follow Host::Process (and Symbiont::Process for its
+   * symbionts) for a host in the arrays, drawing the same random numbers in
+   * the same order as the organism objects would.
+   */
+  void ProcessHost(size_t i) {
+    double resources = PullResources(my_config->RES_DISTRIBUTE());
+    if (resources > 0) DistribResources(i, resources);
+
+    if (host_points[i] >= my_config->HOST_REPRO_RES()) {
+      double baby_int_val = ReproduceHost(host_int_val[i]);
+      host_points[i] = 0;
+
+      baby_sym_int_val.resize(0);
+      baby_sym_infection_chance.resize(0);
+      for (size_t slot = i * sym_limit; slot < i * sym_limit + sym_count[i]; slot++) {
+        if (WillTransmit() && sym_points[slot] >= my_config->SYM_VERT_TRANS_RES()) {
+          double sym_baby_int_val = ReproduceSym(sym_int_val[slot]);
+          sym_points[slot] = sym_points[slot] - my_config->SYM_VERT_TRANS_RES();
+          if (baby_sym_int_val.size() < (size_t) my_config->SYM_LIMIT() && SymAllowedIn(baby_sym_int_val.size())) {
+            baby_sym_int_val.push_back(sym_baby_int_val);
+            baby_sym_infection_chance.push_back(sym_infection_chance[slot]);
+          }
+          GetVerticalTransmissionAttemptCount().AddDatum(1);
+        }
+      }
+
+      emp::WorldPosition pos = fun_find_birth_pos(nullptr, i);
+      if (pos.IsValid() && pos.GetIndex() != i) PlaceHost(pos.GetIndex(), baby_int_val);
+    }
+
+    for (size_t j = 0; j < sym_count[i]; j++) {
+      size_t slot = i * sym_limit + j;
+      if (!sym_dead[slot]) {
+        if (my_config->HORIZ_TRANS() && sym_points[slot] >= my_config->SYM_HORIZ_TRANS_RES()) {
+          sym_points[slot] = 0;
+          double sym_baby_int_val = ReproduceSym(sym_int_val[slot]);
+          double sym_baby_infection_chance = sym_infection_chance[slot];
+          int new_host_pos = GetNeighborHostCell(i);
+          bool infected = new_host_pos > -1 && AddSymbiont(new_host_pos, sym_baby_int_val, sym_baby_infection_chance);
+          GetHorizontalTransmissionAttemptCount().AddDatum(1);
+          if (infected) GetHorizontalTransmissionSuccessCount().AddDatum(1);
+        }
+        sym_age[slot]++;
+        if (sym_age[slot] > my_config->SYM_AGE_MAX() && my_config->SYM_AGE_MAX() > 0) sym_dead[slot] = 1;
+      }
+      if (sym_dead[slot]) RemoveSymbiont(i, j); //as in Host::Process, the next symbiont waits until the next update
+    }
+
+    host_age[i]++;
+    if (host_age[i] > my_config->HOST_AGE_MAX() && my_config->HOST_AGE_MAX() > 0) host_dead[i] = 1;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To run one update on the arrays, visiting the cells in the
+   * same random order as SymWorld::Update.
+   */
+  void Update() {
+    if (!loaded) LoadPopulation();
+    emp::World<Organism>::Update();
+
+    if (HasLimitedResources()) {
+      total_res += my_config->LIMITED_RES_INFLOW();
+    }
+
+    FillPermutation(GetRandom(), cell_order, GetSize());
+    for (size_t i : cell_order) {
+      if (!host_alive[i]) continue;
+      ProcessHost(i);
+      if (host_dead[i]) {
+        host_alive[i] = 0;
+        sym_count[i] = 0;
+      }
+    }
+  }
+
+  /**
+   * Input: Whether progress should be printed.
+   *
+   * Output: None
+   *
+   * Purpose: To run the updates and then the no-mutation updates on the
+   * arrays, leaving the final population in pop.
+   */
+  void RunExperiment(bool verbose=true) {
+    int numupdates = my_config->UPDATES();
+    for (int i = 0; i < numupdates; i++) {
+      if(verbose && (i%my_config->DATA_INT())==0) {
+        std::cout <<"Update: "<< i << std::endl;
+        std::cout.flush();
+      }
+      Update();
+    }
+
+    int num_no_mut_updates = my_config->NO_MUT_UPDATES();
+    if(num_no_mut_updates > 0) {
+      SetMutationZero();
+    }
+    for (int i = 0; i < num_no_mut_updates; i++) {
+      if(verbose && (i%my_config->DATA_INT())==0) {
+        std::cout <<"No mutation update: "<< i << std::endl;
+        std::cout.flush();
+      }
+      Update();
+    }
+    if (loaded) StorePopulation();
+  }
+};
+#endif
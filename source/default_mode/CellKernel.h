@@ -0,0 +1,43 @@
+#ifndef CELL_KERNEL_H
+#define CELL_KERNEL_H
+
+#include "../../Empirical/include/emp/base/Ptr.hpp"
+#include "../Organism.h"
+#include <type_traits>
+#include <typeinfo>
+
+/**
+ * Input: The types of the world's hosts and symbionts (or Organism, where
+ * they can be of more than one type), the world, the cell to be processed,
+ * and the settings to process it with (see ConfigSnapshot.h).
+ *
+ * Output: None
+ *
+ * Purpose: To process the host and the free-living symbiont in a cell,
+ * with the calls on them bound at compile time when their types are known.
+ * SymWorld::ProcessCell runs it with the live config, and SymWorldT runs it
+ * with the kernels compiled for the world's config snapshot.
+ */
+template <typename HOST, typename SYM, typename WORLD, typename PARAMS>
+void ProcessCellAs(WORLD & world, size_t i, const PARAMS & params) {
+  if (world.IsOccupied(i) == false && !world.HasFreeSymAt(i)){ return;} // no organism at that cell
+  if(world.IsOccupied(i)){//can't call GetDead on a deleted sym, so
+    emp::Ptr<HOST> host = world.GetOrgPtr(i).template Cast<HOST>();
+    emp_assert((std::is_same<HOST, Organism>::value || typeid(*world.GetOrgPtr(i)) == typeid(HOST)));
+    if constexpr (std::is_same<HOST, Organism>::value) host->Process(i);
+    else host->template ProcessWith<SYM>(i, params);
+    host = world.GetOrgPtr(i).template Cast<HOST>(); //the cell may hold the host's offspring now
+    if (host->GetDead() && params.Synchronous()) { //dead hosts stay until the end of a synchronous update
+      world.HoldDeath(i);
+    } else if (host->GetDead()) { //Check if the host died
+      world.DoDeath(i);
+    }
+  }
+  if(world.HasFreeSymAt(i)){ //for sym movement reasons, syms are deleted the update after they are set to dead
+    emp::WorldPosition sym_pos = emp::WorldPosition(0,i);
+    emp::Ptr<SYM> sym = world.GetSymAt(i).template Cast<SYM>();
+    if (sym->GetDead()) world.DoSymDeath(i); //Might have died since their last time being processed
+    else ProcessAs(sym, sym_pos, params); //index 0, since it's freeliving, and id its location in the world
+  }
+}
+#endif
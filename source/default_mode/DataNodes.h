@@ -21,6 +21,10 @@ void SymWorld::CreateDataFiles(){
   if(my_config->FREE_LIVING_SYMS() == 1){
     SetUpFreeLivingSymFile(my_config->FILE_PATH()+"FreeLivingSyms_"+my_config->FILE_NAME()+file_ending).SetTimingRepeat(TIMING_REPEAT);
   }
+
+  if(my_config->MEMORY_REPORT() == 1){
+    OpenMemoryReportFile(my_config->FILE_PATH()+"MemoryReport"+my_config->FILE_NAME()+file_ending);
+  }
 }
 
 /**
@@ -35,35 +39,35 @@ void SymWorld::CreateDataFiles(){
  * symbiont's interaction values.
  */
 emp::DataFile & SymWorld::SetupSymIntValFile(const std::string & filename) {
-  auto & file = SetupFile(filename);
+  auto & file = SetupStatsFile(filename);
   auto & node = GetSymIntValDataNode();
   auto & node1 = GetSymCountDataNode();
 
   file.AddVar(update, "update", "Update");
-  file.AddMean(node, "mean_intval", "Average symbiont interaction value");
+  AddStatsMean(file, node, "mean_intval", "Average symbiont interaction value");
   file.AddTotal(node1, "count", "Total number of symbionts");
 
   //interaction val histogram
-  file.AddHistBin(node, 0, "Hist_-1", "Count for histogram bin -1 to <-0.9");
-  file.AddHistBin(node, 1, "Hist_-0.9", "Count for histogram bin -0.9 to <-0.8");
-  file.AddHistBin(node, 2, "Hist_-0.8", "Count for histogram bin -0.8 to <-0.7");
-  file.AddHistBin(node, 3, "Hist_-0.7", "Count for histogram bin -0.7 to <-0.6");
-  file.AddHistBin(node, 4, "Hist_-0.6", "Count for histogram bin -0.6 to <-0.5");
-  file.AddHistBin(node, 5, "Hist_-0.5", "Count for histogram bin -0.5 to <-0.4");
-  file.AddHistBin(node, 6, "Hist_-0.4", "Count for histogram bin -0.4 to <-0.3");
-  file.AddHistBin(node, 7, "Hist_-0.3", "Count for histogram bin -0.3 to <-0.2");
-  file.AddHistBin(node, 8, "Hist_-0.2", "Count for histogram bin -0.2 to <-0.1");
-  file.AddHistBin(node, 9, "Hist_-0.1", "Count for histogram bin -0.1 to <0.0");
-  file.AddHistBin(node, 10, "Hist_0.0", "Count for histogram bin 0.0 to <0.1");
-  file.AddHistBin(node, 11, "Hist_0.1", "Count for histogram bin 0.1 to <0.2");
-  file.AddHistBin(node, 12, "Hist_0.2", "Count for histogram bin 0.2 to <0.3");
-  file.AddHistBin(node, 13, "Hist_0.3", "Count for histogram bin 0.3 to <0.4");
-  file.AddHistBin(node, 14, "Hist_0.4", "Count for histogram bin 0.4 to <0.5");
-  file.AddHistBin(node, 15, "Hist_0.5", "Count for histogram bin 0.5 to <0.6");
-  file.AddHistBin(node, 16, "Hist_0.6", "Count for histogram bin 0.6 to <0.7");
-  file.AddHistBin(node, 17, "Hist_0.7", "Count for histogram bin 0.7 to <0.8");
-  file.AddHistBin(node, 18, "Hist_0.8", "Count for histogram bin 0.8 to <0.9");
-  file.AddHistBin(node, 19, "Hist_0.9", "Count for histogram bin 0.9 to 1.0");
+  AddStatsHistBin(file, node, 0, "Hist_-1", "Count for histogram bin -1 to <-0.9");
+  AddStatsHistBin(file, node, 1, "Hist_-0.9", "Count for histogram bin -0.9 to <-0.8");
+  AddStatsHistBin(file, node, 2, "Hist_-0.8", "Count for histogram bin -0.8 to <-0.7");
+  AddStatsHistBin(file, node, 3, "Hist_-0.7", "Count for histogram bin -0.7 to <-0.6");
+  AddStatsHistBin(file, node, 4, "Hist_-0.6", "Count for histogram bin -0.6 to <-0.5");
+  AddStatsHistBin(file, node, 5, "Hist_-0.5", "Count for histogram bin -0.5 to <-0.4");
+  AddStatsHistBin(file, node, 6, "Hist_-0.4", "Count for histogram bin -0.4 to <-0.3");
+  AddStatsHistBin(file, node, 7, "Hist_-0.3", "Count for histogram bin -0.3 to <-0.2");
+  AddStatsHistBin(file, node, 8, "Hist_-0.2", "Count for histogram bin -0.2 to <-0.1");
+  AddStatsHistBin(file, node, 9, "Hist_-0.1", "Count for histogram bin -0.1 to <0.0");
+  AddStatsHistBin(file, node, 10, "Hist_0.0", "Count for histogram bin 0.0 to <0.1");
+  AddStatsHistBin(file, node, 11, "Hist_0.1", "Count for histogram bin 0.1 to <0.2");
+  AddStatsHistBin(file, node, 12, "Hist_0.2", "Count for histogram bin 0.2 to <0.3");
+  AddStatsHistBin(file, node, 13, "Hist_0.3", "Count for histogram bin 0.3 to <0.4");
+  AddStatsHistBin(file, node, 14, "Hist_0.4", "Count for histogram bin 0.4 to <0.5");
+  AddStatsHistBin(file, node, 15, "Hist_0.5", "Count for histogram bin 0.5 to <0.6");
+  AddStatsHistBin(file, node, 16, "Hist_0.6", "Count for histogram bin 0.6 to <0.7");
+  AddStatsHistBin(file, node, 17, "Hist_0.7", "Count for histogram bin 0.7 to <0.8");
+  AddStatsHistBin(file, node, 18, "Hist_0.8", "Count for histogram bin 0.8 to <0.9");
+  AddStatsHistBin(file, node, 19, "Hist_0.9", "Count for histogram bin 0.9 to 1.0");
 
   file.PrintHeaderKeys();
 
@@ -83,7 +87,7 @@ emp::DataFile & SymWorld::SetupSymIntValFile(const std::string & filename) {
  * host's interaction values. Prints header keys to the file.
  */
 emp::DataFile & SymWorld::SetupHostIntValFile(const std::string & filename) {
-  auto & file = SetupFile(filename);
+  auto & file = SetupStatsFile(filename);
   SetupHostFileColumns(file);
   file.PrintHeaderKeys();
   return file;
@@ -104,29 +108,29 @@ void SymWorld::SetupHostFileColumns(emp::DataFile & file){
   auto & uninf_hosts_node = GetUninfectedHostsDataNode();
 
   file.AddVar(update, "update", "Update");
-  file.AddMean(node, "mean_intval", "Average host interaction value");
+  AddStatsMean(file, node, "mean_intval", "Average host interaction value");
   file.AddTotal(node1, "count", "Total number of hosts");
   file.AddTotal(uninf_hosts_node, "uninfected_host_count", "Total number of hosts that are uninfected");
-  file.AddHistBin(node, 0, "Hist_-1", "Count for histogram bin -1 to <-0.9");
-  file.AddHistBin(node, 1, "Hist_-0.9", "Count for histogram bin -0.9 to <-0.8");
-  file.AddHistBin(node, 2, "Hist_-0.8", "Count for histogram bin -0.8 to <-0.7");
-  file.AddHistBin(node, 3, "Hist_-0.7", "Count for histogram bin -0.7 to <-0.6");
-  file.AddHistBin(node, 4, "Hist_-0.6", "Count for histogram bin -0.6 to <-0.5");
-  file.AddHistBin(node, 5, "Hist_-0.5", "Count for histogram bin -0.5 to <-0.4");
-  file.AddHistBin(node, 6, "Hist_-0.4", "Count for histogram bin -0.4 to <-0.3");
-  file.AddHistBin(node, 7, "Hist_-0.3", "Count for histogram bin -0.3 to <-0.2");
-  file.AddHistBin(node, 8, "Hist_-0.2", "Count for histogram bin -0.2 to <-0.1");
-  file.AddHistBin(node, 9, "Hist_-0.1", "Count for histogram bin -0.1 to <0.0");
-  file.AddHistBin(node, 10, "Hist_0.0", "Count for histogram bin 0.0 to <0.1");
-  file.AddHistBin(node, 11, "Hist_0.1", "Count for histogram bin 0.1 to <0.2");
-  file.AddHistBin(node, 12, "Hist_0.2", "Count for histogram bin 0.2 to <0.3");
-  file.AddHistBin(node, 13, "Hist_0.3", "Count for histogram bin 0.3 to <0.4");
-  file.AddHistBin(node, 14, "Hist_0.4", "Count for histogram bin 0.4 to <0.5");
-  file.AddHistBin(node, 15, "Hist_0.5", "Count for histogram bin 0.5 to <0.6");
-  file.AddHistBin(node, 16, "Hist_0.6", "Count for histogram bin 0.6 to <0.7");
-  file.AddHistBin(node, 17, "Hist_0.7", "Count for histogram bin 0.7 to <0.8");
-  file.AddHistBin(node, 18, "Hist_0.8", "Count for histogram bin 0.8 to <0.9");
-  file.AddHistBin(node, 19, "Hist_0.9", "Count for histogram bin 0.9 to 1.0");
+  AddStatsHistBin(file, node, 0, "Hist_-1", "Count for histogram bin -1 to <-0.9");
+  AddStatsHistBin(file, node, 1, "Hist_-0.9", "Count for histogram bin -0.9 to <-0.8");
+  AddStatsHistBin(file, node, 2, "Hist_-0.8", "Count for histogram bin -0.8 to <-0.7");
+  AddStatsHistBin(file, node, 3, "Hist_-0.7", "Count for histogram bin -0.7 to <-0.6");
+  AddStatsHistBin(file, node, 4, "Hist_-0.6", "Count for histogram bin -0.6 to <-0.5");
+  AddStatsHistBin(file, node, 5, "Hist_-0.5", "Count for histogram bin -0.5 to <-0.4");
+  AddStatsHistBin(file, node, 6, "Hist_-0.4", "Count for histogram bin -0.4 to <-0.3");
+  AddStatsHistBin(file, node, 7, "Hist_-0.3", "Count for histogram bin -0.3 to <-0.2");
+  AddStatsHistBin(file, node, 8, "Hist_-0.2", "Count for histogram bin -0.2 to <-0.1");
+  AddStatsHistBin(file, node, 9, "Hist_-0.1", "Count for histogram bin -0.1 to <0.0");
+  AddStatsHistBin(file, node, 10, "Hist_0.0", "Count for histogram bin 0.0 to <0.1");
+  AddStatsHistBin(file, node, 11, "Hist_0.1", "Count for histogram bin 0.1 to <0.2");
+  AddStatsHistBin(file, node, 12, "Hist_0.2", "Count for histogram bin 0.2 to <0.3");
+  AddStatsHistBin(file, node, 13, "Hist_0.3", "Count for histogram bin 0.3 to <0.4");
+  AddStatsHistBin(file, node, 14, "Hist_0.4", "Count for histogram bin 0.4 to <0.5");
+  AddStatsHistBin(file, node, 15, "Hist_0.5", "Count for histogram bin 0.5 to <0.6");
+  AddStatsHistBin(file, node, 16, "Hist_0.6", "Count for histogram bin 0.6 to <0.7");
+  AddStatsHistBin(file, node, 17, "Hist_0.7", "Count for histogram bin 0.7 to <0.8");
+  AddStatsHistBin(file, node, 18, "Hist_0.8", "Count for histogram bin 0.8 to <0.9");
+  AddStatsHistBin(file, node, 19, "Hist_0.9", "Count for histogram bin 0.9 to 1.0");
 }
 
 
@@ -145,7 +149,7 @@ void SymWorld::SetupHostFileColumns(emp::DataFile & file){
  * and hosted symbionts.
  */
 emp::DataFile & SymWorld::SetUpFreeLivingSymFile(const std::string & filename){
-  auto & file = SetupFile(filename);
+  auto & file = SetupStatsFile(filename);
   auto & node1 = GetSymCountDataNode(); //count
   auto & node2 = GetCountFreeSymsDataNode();
   auto & node3 = GetCountHostedSymsDataNode();
@@ -165,14 +169,14 @@ emp::DataFile & SymWorld::SetUpFreeLivingSymFile(const std::string & filename){
 
 
   //interaction val
-  file.AddMean(node4, "mean_intval", "Average symbiont interaction value");
-  file.AddMean(node5, "mean_freeintval", "Average free symbiont interaction value");
-  file.AddMean(node6, "mean_hostedintval", "Average hosted symbiont interaction value");
+  AddStatsMean(file, node4, "mean_intval", "Average symbiont interaction value");
+  AddStatsMean(file, node5, "mean_freeintval", "Average free symbiont interaction value");
+  AddStatsMean(file, node6, "mean_hostedintval", "Average hosted symbiont interaction value");
 
   //infection chance
-  file.AddMean(node7, "mean_infectchance", "Average symbiont infection chance");
-  file.AddMean(node8, "mean_freeinfectchance", "Average free symbiont infection chance");
-  file.AddMean(node9, "mean_hostedinfectchance", "Average hosted symbiont infection chance");
+  AddStatsMean(file, node7, "mean_infectchance", "Average symbiont infection chance");
+  AddStatsMean(file, node8, "mean_freeinfectchance", "Average free symbiont infection chance");
+  AddStatsMean(file, node9, "mean_hostedinfectchance", "Average hosted symbiont infection chance");
 
   file.PrintHeaderKeys();
 
@@ -236,14 +240,10 @@ emp::DataFile & SymWorld::SetUpTransmissionFile(const std::string & filename){
 emp::DataMonitor<int>& SymWorld::GetHostCountDataNode() {
   if(!data_node_hostcount) {
     data_node_hostcount.New();
-    OnUpdate([this](size_t){
-      data_node_hostcount -> Reset();
-      for (size_t i = 0; i< pop.size(); i++){
-        if (IsOccupied(i)){
-          data_node_hostcount->AddDatum(1);
-        }
-      }
-    });
+    AddStatsCollector({[this](){
+      data_node_hostcount->Reset();
+      data_node_hostcount->AddDatum(GetNumHosts());
+    }});
   }
   return *data_node_hostcount;
 }
@@ -261,17 +261,10 @@ emp::DataMonitor<int>& SymWorld::GetHostCountDataNode() {
 emp::DataMonitor<int>& SymWorld::GetSymCountDataNode() {
   if(!data_node_symcount) {
     data_node_symcount.New();
-    OnUpdate([this](size_t){
-      data_node_symcount -> Reset();
-      for (size_t i = 0; i < pop.size(); i++){
-        if(IsOccupied(i)){
-          data_node_symcount->AddDatum((pop[i]->GetSymbionts()).size());
-        }
-        if(sym_pop[i]){
-          data_node_symcount->AddDatum(1);
-        }
-      }
-    });
+    AddStatsCollector({[this](){
+      data_node_symcount->Reset();
+      data_node_symcount->AddDatum(GetNumHostedSyms() + GetNumFreeSyms());
+    }});
   }
   return *data_node_symcount;
 }
@@ -289,14 +282,10 @@ emp::DataMonitor<int>& SymWorld::GetSymCountDataNode() {
 emp::DataMonitor<int>& SymWorld::GetCountHostedSymsDataNode(){
   if (!data_node_hostedsymcount) {
     data_node_hostedsymcount.New();
-    OnUpdate([this](size_t){
+    AddStatsCollector({[this](){
       data_node_hostedsymcount->Reset();
-      for (size_t i = 0; i< pop.size(); i++){
-        if (IsOccupied(i)){
-          data_node_hostedsymcount->AddDatum(pop[i]->GetSymbionts().size());
-        }
-      }
-    });
+      data_node_hostedsymcount->AddDatum(GetNumHostedSyms());
+    }});
   }
   return *data_node_hostedsymcount;
 }
@@ -314,14 +303,10 @@ emp::DataMonitor<int>& SymWorld::GetCountHostedSymsDataNode(){
 emp::DataMonitor<int>& SymWorld::GetCountFreeSymsDataNode(){
   if (!data_node_freesymcount) {
     data_node_freesymcount.New();
-    OnUpdate([this](size_t){
+    AddStatsCollector({[this](){
       data_node_freesymcount->Reset();
-      for (size_t i = 0; i< pop.size(); i++){
-        if (sym_pop[i]){
-          data_node_freesymcount->AddDatum(1);
-        }
-      }
-    });
+      data_node_freesymcount->AddDatum(GetNumFreeSyms());
+    }});
   }
   return *data_node_freesymcount;
 }
@@ -340,17 +325,10 @@ emp::DataMonitor<int>& SymWorld::GetUninfectedHostsDataNode() {
   //keep track of host organisms that are uninfected
   if(!data_node_uninf_hosts) {
     data_node_uninf_hosts.New();
-    OnUpdate([this](size_t){
-  data_node_uninf_hosts -> Reset();
-
-  for (size_t i = 0; i < pop.size(); i++) {
-    if(IsOccupied(i)) {
-      if((pop[i]->GetSymbionts()).empty()) {
-        data_node_uninf_hosts->AddDatum(1);
-      }
-    } //endif
-  } //end for
-}); //end OnUpdate
+    AddStatsCollector({[this](){
+      data_node_uninf_hosts->Reset();
+      data_node_uninf_hosts->AddDatum(GetNumHosts() - GetNumInfectedHosts());
+    }});
   } //end if
   return *data_node_uninf_hosts;
 }
@@ -370,14 +348,7 @@ emp::DataMonitor<int>& SymWorld::GetUninfectedHostsDataNode() {
 emp::DataMonitor<double, emp::data::Histogram>& SymWorld::GetHostIntValDataNode() {
   if (!data_node_hostintval) {
     data_node_hostintval.New();
-    OnUpdate([this](size_t){
-      data_node_hostintval->Reset();
-      for (size_t i = 0; i< pop.size(); i++){
-        if (IsOccupied(i)){
-          data_node_hostintval->AddDatum(pop[i]->GetIntVal());
-        }
-      }
-    });
+    AddStatsCollector(data_node_hostintval, [](emp::Ptr<Organism> host){return host->GetIntVal();});
   }
   data_node_hostintval->SetupBins(-1.0, 1.1, 21);
   return *data_node_hostintval;
@@ -396,21 +367,9 @@ emp::DataMonitor<double, emp::data::Histogram>& SymWorld::GetHostIntValDataNode(
 emp::DataMonitor<double,emp::data::Histogram>& SymWorld::GetSymIntValDataNode() {
   if (!data_node_symintval) {
     data_node_symintval.New();
-    OnUpdate([this](size_t){
-      data_node_symintval->Reset();
-      for (size_t i = 0; i< pop.size(); i++) {
-        if (IsOccupied(i)) {
-          emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
-          size_t sym_size = syms.size();
-          for(size_t j=0; j< sym_size; j++){
-            data_node_symintval->AddDatum(syms[j]->GetIntVal());
-          }//close for
-        }
-        if (sym_pop[i]) {
-          data_node_symintval->AddDatum(sym_pop[i]->GetIntVal());
-        } //close if
-      }//close for
-    });
+    AddStatsCollector(data_node_symintval, nullptr,
+      [](emp::Ptr<Organism>, emp::Ptr<Organism> sym){return sym->GetIntVal();},
+      [](emp::Ptr<Organism> sym){return sym->GetIntVal();});
   }
   data_node_symintval->SetupBins(-1.0, 1.1, 21);
   return *data_node_symintval;
@@ -429,14 +388,8 @@ emp::DataMonitor<double,emp::data::Histogram>& SymWorld::GetSymIntValDataNode()
 emp::DataMonitor<double,emp::data::Histogram>& SymWorld::GetFreeSymIntValDataNode() {
   if (!data_node_freesymintval) {
     data_node_freesymintval.New();
-    OnUpdate([this](size_t){
-      data_node_freesymintval->Reset();
-      for (size_t i = 0; i< pop.size(); i++) {
-        if (sym_pop[i]) {
-          data_node_freesymintval->AddDatum(sym_pop[i]->GetIntVal());
-        } //close if
-      }//close for
-    });
+    AddStatsCollector(data_node_freesymintval, nullptr, nullptr,
+      [](emp::Ptr<Organism> sym){return sym->GetIntVal();});
   }
   data_node_freesymintval->SetupBins(-1.0, 1.1, 21);
   return *data_node_freesymintval;
@@ -454,18 +407,8 @@ emp::DataMonitor<double,emp::data::Histogram>& SymWorld::GetFreeSymIntValDataNod
 emp::DataMonitor<double,emp::data::Histogram>& SymWorld::GetHostedSymIntValDataNode() {
   if (!data_node_hostedsymintval) {
     data_node_hostedsymintval.New();
-    OnUpdate([this](size_t){
-      data_node_hostedsymintval->Reset();
-      for (size_t i = 0; i< pop.size(); i++) {
-        if (IsOccupied(i)) {
-          emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
-          size_t sym_size = syms.size();
-          for(size_t j=0; j< sym_size; j++){
-            data_node_hostedsymintval->AddDatum(syms[j]->GetIntVal());
-          }//close for
-        }//close if
-      }//close for
-    });
+    AddStatsCollector(data_node_hostedsymintval, nullptr,
+      [](emp::Ptr<Organism>, emp::Ptr<Organism> sym){return sym->GetIntVal();});
   }
   data_node_hostedsymintval->SetupBins(-1.0, 1.1, 21);
   return *data_node_hostedsymintval;
@@ -484,21 +427,9 @@ emp::DataMonitor<double,emp::data::Histogram>& SymWorld::GetHostedSymIntValDataN
 emp::DataMonitor<double,emp::data::Histogram>& SymWorld::GetSymInfectChanceDataNode() {
   if (!data_node_syminfectchance) {
     data_node_syminfectchance.New();
-    OnUpdate([this](size_t){
-      data_node_syminfectchance->Reset();
-      for (size_t i = 0; i< pop.size(); i++) {
-        if (IsOccupied(i)) {
-          emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
-          size_t sym_size = syms.size();
-          for(size_t j=0; j< sym_size; j++){
-            data_node_syminfectchance->AddDatum(syms[j]->GetInfectionChance());
-          }//close for
-        }
-        if (sym_pop[i]) {
-          data_node_syminfectchance->AddDatum(sym_pop[i]->GetInfectionChance());
-        } //close if
-      }//close for
-    });
+    AddStatsCollector(data_node_syminfectchance, nullptr,
+      [](emp::Ptr<Organism>, emp::Ptr<Organism> sym){return sym->GetInfectionChance();},
+      [](emp::Ptr<Organism> sym){return sym->GetInfectionChance();});
   }
   data_node_syminfectchance->SetupBins(0, 1.1, 11);
   return *data_node_syminfectchance;
@@ -518,14 +449,8 @@ emp::DataMonitor<double,emp::data::Histogram>& SymWorld::GetSymInfectChanceDataN
 emp::DataMonitor<double,emp::data::Histogram>& SymWorld::GetFreeSymInfectChanceDataNode() {
   if (!data_node_freesyminfectchance) {
     data_node_freesyminfectchance.New();
-    OnUpdate([this](size_t){
-      data_node_freesyminfectchance->Reset();
-      for (size_t i = 0; i< pop.size(); i++) {
-        if (sym_pop[i]) {
-          data_node_freesyminfectchance->AddDatum(sym_pop[i]->GetInfectionChance());
-        } //close if
-      }//close for
-    });
+    AddStatsCollector(data_node_freesyminfectchance, nullptr, nullptr,
+      [](emp::Ptr<Organism> sym){return sym->GetInfectionChance();});
   }
   data_node_freesyminfectchance->SetupBins(0, 1.1, 11);
   return *data_node_freesyminfectchance;
@@ -544,18 +469,8 @@ emp::DataMonitor<double,emp::data::Histogram>& SymWorld::GetFreeSymInfectChanceD
 emp::DataMonitor<double,emp::data::Histogram>& SymWorld::GetHostedSymInfectChanceDataNode() {
   if (!data_node_hostedsyminfectchance) {
     data_node_hostedsyminfectchance.New();
-    OnUpdate([this](size_t){
-      data_node_hostedsyminfectchance->Reset();
-      for (size_t i = 0; i< pop.size(); i++) {
-        if (IsOccupied(i)) {
-          emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
-          size_t sym_size = syms.size();
-          for(size_t j=0; j< sym_size; j++){
-            data_node_hostedsyminfectchance->AddDatum(syms[j]->GetInfectionChance());
-          }//close for
-        }
-      }//close for
-    });
+    AddStatsCollector(data_node_hostedsyminfectchance, nullptr,
+      [](emp::Ptr<Organism>, emp::Ptr<Organism> sym){return sym->GetInfectionChance();});
   }
   data_node_hostedsyminfectchance->SetupBins(0, 1.1, 11);
   return *data_node_hostedsyminfectchance;
@@ -612,4 +527,428 @@ emp::DataMonitor<int>& SymWorld::GetVerticalTransmissionAttemptCount() {
   return *data_node_attempts_verttrans;
 }
 
+
+/**
+ * Input: The collector of a data monitor.
+ *
+ * Output: None
+ *
+ * Purpose: To have a data monitor recomputed from the population every
+ * update, or only when a file prints it once one is set up with
+ * SetupStatsFile. The first collector added sets up the pass that feeds
+ * them all.
+ */
+void SymWorld::AddStatsCollector(const StatsCollector & collector) {
+  if (stats_collectors.empty()) {
+    OnUpdate([this](size_t){
+      if (!stats_on_print) CollectStats();
+    });
+  }
+  size_t id = stats_collectors.size();
+  stats_collectors.push_back(collector);
+  if (collector.host) stats_host_ids.push_back(id);
+  if (collector.hosted_sym) stats_hosted_sym_ids.push_back(id);
+  if (collector.free_sym) stats_free_sym_ids.push_back(id);
+}
+
+
+/**
+ * Input: The name of the file to set up.
+ *
+ * Output: The DataFile that has been set up.
+ *
+ * Purpose: To set up a file that prints data monitors of the population.
+ * Once there is one, the monitors are no longer recomputed every update,
+ * but only on updates that some such file prints, just before the first of
+ * them does. Monitors that count events as they happen, like the
+ * transmission counts, are not recomputed, so they still accumulate
+ * between prints.
+ */
+emp::DataFile & SymWorld::SetupStatsFile(const std::string & filename) {
+  auto & file = SetupFile(filename);
+  stats_on_print = true;
+  file.AddPreFun([this](){
+    if (stats_update == GetUpdate()) return;
+    stats_update = GetUpdate();
+    CollectStats();
+  });
+  return file;
+}
+
+
+/**
+ * Input: The range of cells to go through, and what to do with each datum
+ * taken: a function of the index of the collector it is for and its value.
+ *
+ * Output: None
+ *
+ * Purpose: To take the collectors' data from a range of cells, in cell
+ * order: for each cell, from its host, its host's symbionts and its
+ * free-living symbiont.
+ */
+template <typename SINK>
+void SymWorld::VisitStats(size_t begin, size_t end, SINK & sink) {
+  bool wants_free_syms = !stats_free_sym_ids.empty();
+  for (size_t i = begin; i < end; i++) {
+    if (IsOccupied(i)) {
+      emp::Ptr<Organism> host = pop[i];
+      for (size_t id : stats_host_ids) sink(id, stats_collectors[id].host(host));
+      if (!stats_hosted_sym_ids.empty()) {
+        for (emp::Ptr<Organism> sym : host->GetSymbionts()) {
+          for (size_t id : stats_hosted_sym_ids) sink(id, stats_collectors[id].hosted_sym(host, sym));
+        }
+      }
+    }
+    if (wants_free_syms && HasFreeSymAt(i)) {
+      emp::Ptr<Organism> sym = sym_pop[i];
+      for (size_t id : stats_free_sym_ids) sink(id, stats_collectors[id].free_sym(sym));
+    }
+  }
+}
+
+
+/**
+ * Input: None
+ *
+ * Output: None
+ *
+ * Purpose: To recompute the data monitors with a single pass over the
+ * population, visiting each host, hosted symbiont and free-living symbiont
+ * once. Each monitor gets its data in the same (cell) order as it would
+ * from a scan of its own, so the values it reports are the same. If only
+ * free-living symbionts are wanted, only the occupied cells are visited.
+ * Large worlds are gone through on THREADS threads, or only a sample of
+ * STATS_SAMPLE of their cells is. Monitors of counts read the population
+ * counts instead, and debug builds check those against a scan here.
+ */
+void SymWorld::CollectStats() {
+  emp_assert(CountsMatchPopulation(), "The population counts are out of step with the population");
+  for (StatsCollector & collector : stats_collectors) {
+    if (collector.reset) collector.reset();
+    collector.standard_error = 0;
+  }
+
+  size_t sample_size = std::max(my_config->STATS_SAMPLE(), 0);
+  if (sample_size > 0 && sample_size < pop.size()) {
+    CollectSampledStats(sample_size);
+    return;
+  }
+  stats_sample_scale = 1;
+
+  if (stats_host_ids.empty() && stats_hosted_sym_ids.empty()) {
+    if (stats_free_sym_ids.empty() || !free_living_layer) return;
+    for (size_t i : sym_pop.GetOccupiedCells()) {
+      for (size_t id : stats_free_sym_ids) {
+        stats_collectors[id].add(stats_collectors[id].free_sym(sym_pop[i]));
+      }
+    }
+    return;
+  }
+
+  size_t num_threads = std::max(my_config->THREADS(), 1);
+  if (num_threads > 1 && pop.size() > STATS_SLICE) {
+    CollectStatsInParallel(num_threads);
+    return;
+  }
+  auto add = [this](size_t id, double val) {stats_collectors[id].add(val);};
+  VisitStats(0, pop.size(), add);
+}
+
+
+/**
+ * Input: The number of threads to use.
+ *
+ * Output: None
+ *
+ * Purpose: To take the collectors' data on several threads. The population
+ * is gone through in rounds of STATS_SLICE cells for each thread. In each
+ * round, each thread takes the data from its own slice into buffers of its
+ * own; then the data are passed on to the monitors, each monitor on a
+ * single thread, slice by slice. The monitors are split between the threads
+ * by how much data they got, the largest first, each to the thread with the
+ * least data so far, so the round is held up by the largest monitor rather
+ * than by a thread with several large ones. Every monitor gets the same
+ * data in the same order as from a single thread, so the values it reports
+ * are the same to the bit, whatever the number of threads.
+ */
+void SymWorld::CollectStatsInParallel(size_t num_threads) {
+  size_t num_collectors = stats_collectors.size();
+  emp::vector<size_t> data_ids;
+  for (size_t id = 0; id < num_collectors; id++) {
+    const StatsCollector & collector = stats_collectors[id];
+    if (collector.host || collector.hosted_sym || collector.free_sym) data_ids.push_back(id);
+  }
+  stats_buffers.resize(num_threads);
+  for (auto & buffers : stats_buffers) buffers.resize(num_collectors);
+
+  //every thread waits here until all of them have arrived
+  std::mutex mutex;
+  std::condition_variable all_arrived;
+  size_t arrived = 0;
+  size_t phase = 0;
+  auto wait_for_all = [&]() {
+    std::unique_lock<std::mutex> lock(mutex);
+    size_t my_phase = phase;
+    if (++arrived == num_threads) {
+      arrived = 0;
+      phase++;
+      all_arrived.notify_all();
+    } else {
+      all_arrived.wait(lock, [&](){return phase != my_phase;});
+    }
+  };
+
+  size_t round_size = num_threads * STATS_SLICE;
+  auto worker = [&](size_t thread) {
+    emp::vector<emp::vector<double>> & buffers = stats_buffers[thread];
+    auto keep = [&buffers](size_t id, double val) {buffers[id].push_back(val);};
+    for (size_t round = 0; round < pop.size(); round += round_size) {
+      for (emp::vector<double> & buffer : buffers) buffer.resize(0);
+      size_t begin = std::min(round + thread * STATS_SLICE, pop.size());
+      size_t end = std::min(begin + STATS_SLICE, pop.size());
+      VisitStats(begin, end, keep);
+      wait_for_all();
+
+      //every thread works out the same split of the monitors
+      emp::vector<std::pair<size_t, size_t>> sizes;
+      for (size_t id : data_ids) {
+        size_t size = 0;
+        for (size_t slice = 0; slice < num_threads; slice++) size += stats_buffers[slice][id].size();
+        sizes.emplace_back(size, id);
+      }
+      std::sort(sizes.begin(), sizes.end(), std::greater<std::pair<size_t, size_t>>());
+      emp::vector<size_t> loads(num_threads, 0);
+      for (auto [size, id] : sizes) {
+        size_t owner = std::min_element(loads.begin(), loads.end()) - loads.begin();
+        loads[owner] += size;
+        if (owner != thread) continue;
+        StatsCollector & collector = stats_collectors[id];
+        for (size_t slice = 0; slice < num_threads; slice++) {
+          for (double val : stats_buffers[slice][id]) collector.add(val);
+        }
+      }
+      wait_for_all();
+    }
+  };
+  emp::vector<std::thread> threads;
+  for (size_t thread = 1; thread < num_threads; thread++) threads.emplace_back(worker, thread);
+  worker(0);
+  for (std::thread & thread : threads) thread.join();
+}
+
+
+/**
+ * Input: The number of cells to sample, fewer than the world has.
+ *
+ * Output: None
+ *
+ * Purpose: To take the collectors' data from a uniform random sample of
+ * cells, drawn without replacement (by Floyd's algorithm, so in as many
+ * steps as cells drawn) and gone through in cell order. A monitor's mean is
+ * then a ratio estimate: the sum of its data over the sampled cells divided
+ * by their number. Its standard error is estimated from how the per-cell
+ * sums and numbers of data vary between the sampled cells, with the finite
+ * population correction; it is NaN when the sample has no data for the
+ * monitor or is a single cell.
+ */
+void SymWorld::CollectSampledStats(size_t sample_size) {
+  size_t num_cells = pop.size();
+  std::unordered_set<size_t> drawn;
+  for (size_t j = num_cells - sample_size; j < num_cells; j++) {
+    size_t cell = stats_random.GetUInt(j + 1);
+    drawn.insert(drawn.count(cell) ? j : cell);
+  }
+  emp::vector<size_t> cells(drawn.begin(), drawn.end());
+  std::sort(cells.begin(), cells.end());
+  stats_sample_scale = (double) num_cells / sample_size;
+
+  //the sums, over the sampled cells, of each collector's per-cell sum (y)
+  //and number (m) of data, and of y*y, m*m and y*m
+  size_t num_collectors = stats_collectors.size();
+  emp::vector<double> cell_sum(num_collectors, 0), cell_count(num_collectors, 0);
+  emp::vector<std::array<double, 5>> sums(num_collectors, {0, 0, 0, 0, 0});
+  auto take = [&](size_t id, double val) {
+    stats_collectors[id].add(val);
+    cell_sum[id] += val;
+    cell_count[id]++;
+  };
+  for (size_t i : cells) {
+    VisitStats(i, i + 1, take);
+    for (size_t id = 0; id < num_collectors; id++) {
+      if (cell_count[id] == 0) continue;
+      double y = cell_sum[id], m = cell_count[id];
+      sums[id][0] += y;
+      sums[id][1] += m;
+      sums[id][2] += y * y;
+      sums[id][3] += m * m;
+      sums[id][4] += y * m;
+      cell_sum[id] = cell_count[id] = 0;
+    }
+  }
+
+  double n = sample_size;
+  double correction = 1 - n / num_cells;
+  for (size_t id = 0; id < num_collectors; id++) {
+    auto [y, m, yy, mm, ym] = sums[id];
+    if (m == 0 || n < 2) {
+      stats_collectors[id].standard_error = std::nan("");
+      continue;
+    }
+    double ratio = y / m;
+    double spread = std::max(yy - 2 * ratio * ym + ratio * ratio * mm, 0.0) / (n - 1);
+    stats_collectors[id].standard_error = std::sqrt(correction * spread / n) / (m / n);
+  }
+}
+
+
+/**
+ * Input: A data monitor.
+ *
+ * Output: The standard error of the mean the monitor reports, or 0 if the
+ * monitor was fed from every cell.
+ *
+ * Purpose: To report how precise a sampled mean is (see CollectSampledStats).
+ */
+double SymWorld::GetStatsStandardError(const void * node) {
+  for (const StatsCollector & collector : stats_collectors) {
+    if (collector.node == node) return collector.standard_error;
+  }
+  return 0;
+}
+
+
+/**
+ * Input: None
+ *
+ * Output: Whether the population counts are what a scan of the population
+ * gives.
+ *
+ * Purpose: To check the population counts kept by CountHost.
+ */
+bool SymWorld::CountsMatchPopulation() {
+  size_t hosts = 0, hosted_syms = 0, infected_hosts = 0, lytic_hosts = 0;
+  for (size_t i = 0; i < pop.size(); i++) {
+    if (!IsOccupied(i)) continue;
+    SymbiontList & syms = pop[i]->GetSymbionts();
+    hosts++;
+    hosted_syms += syms.size();
+    if (!syms.empty()) infected_hosts++;
+    for (emp::Ptr<Organism> sym : syms) {
+      if (sym->IsPhage() && !sym->GetLysogeny()) {
+        lytic_hosts++;
+        break;
+      }
+    }
+  }
+  size_t free_syms = free_living_layer ? sym_pop.GetOccupiedCells().size() : 0;
+  return hosts == GetNumHosts() && hosted_syms == GetNumHostedSyms() && free_syms == GetNumFreeSyms()
+    && infected_hosts == GetNumInfectedHosts() && lytic_hosts == GetNumLyticHosts();
+}
+
+
+/**
+ * Input: None
+ *
+ * Output: The MemoryReport of the world as it stands.
+ *
+ * Purpose: To account for the memory the world takes up: the pop and sym_pop
+ * vectors, the organisms by their exact type (GetName), the heap buffers of
+ * hosts' symbiont lists (lists that fit inside their host count as part of
+ * it), the data monitors, and the host_sys and sym_sys phylogenies. Each
+ * phylogeny is estimated as a Systematics object plus a Taxon and a pointer
+ * to it for each taxon it holds.
+ */
+MemoryReport SymWorld::GetMemoryReport() {
+  MemoryReport report;
+  report.Add("pop", pop.size(), pop.capacity() * sizeof(emp::Ptr<Organism>));
+  report.Add("sym_pop", sym_pop.GetCount(), sym_pop.GetBytes());
+
+  auto add_org = [&report](emp::Ptr<Organism> org) {
+    report.Add(org->GetName(), 1, org->GetObjectSize());
+  };
+  for (size_t i = 0; i < pop.size(); i++) {
+    if (pop[i]) {
+      add_org(pop[i]);
+      if (pop[i]->IsHost()) {
+        for (SymbiontList * syms : {&pop[i]->GetSymbionts(), &pop[i]->GetReproSymbionts()}) {
+          for (emp::Ptr<Organism> sym : *syms) add_org(sym);
+          size_t heap_bytes = syms->GetHeapBytes();
+          report.Add("symbiont_lists", heap_bytes > 0, heap_bytes);
+        }
+      }
+    }
+    if (HasFreeSymAt(i)) add_org(sym_pop[i]);
+  }
+
+  AddDataMonitorsTo(report);
+
+  size_t taxon_bytes = sizeof(emp::Taxon<int>) + sizeof(emp::Ptr<emp::Taxon<int>>);
+  for (auto [name, sys] : {std::make_pair("host_sys", host_sys), std::make_pair("sym_sys", sym_sys)}) {
+    if (!sys) continue;
+    size_t taxa = sys->GetNumActive() + sys->GetNumAncestors() + sys->GetNumOutside();
+    report.Add(name, taxa, sizeof(emp::Systematics<Organism, int>) + taxa * taxon_bytes);
+  }
+  return report;
+}
+
+
+/**
+ * Input: The report to add to.
+ *
+ * Output: None
+ *
+ * Purpose: To account for the world's data monitors. Worlds with monitors
+ * of their own add them after calling this.
+ */
+void SymWorld::AddDataMonitorsTo(MemoryReport & report) {
+  AddHistogramMonitorTo(report, data_node_hostintval);
+  AddHistogramMonitorTo(report, data_node_symintval);
+  AddHistogramMonitorTo(report, data_node_freesymintval);
+  AddHistogramMonitorTo(report, data_node_hostedsymintval);
+  AddHistogramMonitorTo(report, data_node_syminfectchance);
+  AddHistogramMonitorTo(report, data_node_freesyminfectchance);
+  AddHistogramMonitorTo(report, data_node_hostedsyminfectchance);
+  AddMonitorTo(report, data_node_hostcount);
+  AddMonitorTo(report, data_node_symcount);
+  AddMonitorTo(report, data_node_freesymcount);
+  AddMonitorTo(report, data_node_hostedsymcount);
+  AddMonitorTo(report, data_node_uninf_hosts);
+  AddMonitorTo(report, data_node_attempts_horiztrans);
+  AddMonitorTo(report, data_node_successes_horiztrans);
+  AddMonitorTo(report, data_node_attempts_verttrans);
+  for (const auto & buffers : stats_buffers) {
+    for (const emp::vector<double> & buffer : buffers) {
+      report.Add("stats_buffers", buffer.size(), buffer.capacity() * sizeof(double));
+    }
+  }
+}
+
+
+/**
+ * Input: The name of the file to write memory reports to.
+ *
+ * Output: None
+ *
+ * Purpose: To start writing memory reports: one every DATA_INT updates, and
+ * one at the end of RunExperiment.
+ */
+void SymWorld::OpenMemoryReportFile(const std::string & filename) {
+  memory_report_file.open(filename);
+  MemoryReport::WriteHeader(memory_report_file);
+}
+
+
+/**
+ * Input: None
+ *
+ * Output: None
+ *
+ * Purpose: To write the world's memory report, as it stands, to its memory
+ * report file.
+ */
+void SymWorld::WriteMemoryReport() {
+  GetMemoryReport().Write(memory_report_file, GetUpdate());
+  memory_report_file.flush();
+}
+
 #endif
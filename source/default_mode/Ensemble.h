@@ -0,0 +1,153 @@
+#ifndef ENSEMBLE_H
+#define ENSEMBLE_H
+
+#include "SymWorld.h"
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+template <typename WORLD>
+class Ensemble {
+private:
+  /**
+    *
+    * Purpose: Represents each replicate's own copy of the config (with its own
+    * SEED, so that it writes its own _SEED<n> files), random number generator
+    * and world.
+    *
+  */
+  emp::vector<emp::Ptr<SymConfigBase>> configs;
+  emp::vector<emp::Ptr<emp::Random>> randoms;
+  emp::vector<emp::Ptr<WORLD>> worlds;
+
+  /**
+    *
+    * Purpose: Represents the number of replicates run at the same time.
+    *
+  */
+  size_t num_workers = 1;
+
+public:
+  /**
+   * Input: The config shared by the replicates.
+   *
+   * Output: None
+   *
+   * Purpose: To build REPLICATES worlds from the config, seeded with SEED,
+   * SEED + 1, and so on, so that each replicate is the run a separate process
+   * with that seed would make.
+   */
+  Ensemble(SymConfigBase & config) {
+    size_t num_replicates = std::max(1, config.REPLICATES());
+    std::stringstream settings;
+    config.Write(settings);
+    for (size_t n = 0; n < num_replicates; n++) {
+      emp::Ptr<SymConfigBase> replicate_config = emp::NewPtr<SymConfigBase>();
+      std::stringstream replicate_settings(settings.str());
+      replicate_config->Read(replicate_settings);
+      replicate_config->SEED(config.SEED() + n);
+      configs.push_back(replicate_config);
+      randoms.push_back(emp::NewPtr<emp::Random>(replicate_config->SEED()));
+      worlds.push_back(emp::NewPtr<WORLD>(*randoms.back(), replicate_config));
+    }
+    size_t hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+    num_workers = std::min(num_replicates, hardware_threads);
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To destruct the replicates' worlds, random number generators and configs.
+   */
+  ~Ensemble() {
+    for (emp::Ptr<WORLD> world : worlds) world.Delete();
+    for (emp::Ptr<emp::Random> random : randoms) random.Delete();
+    for (emp::Ptr<SymConfigBase> config : configs) config.Delete();
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The number of replicates.
+   *
+   * Purpose: To get the number of replicates.
+   */
+  size_t GetSize() const {return worlds.size();}
+
+  /**
+   * Input: The replicate.
+   *
+   * Output: The replicate's world.
+   *
+   * Purpose: To get the world of one replicate.
+   */
+  WORLD & GetWorld(size_t n) {return *worlds[n];}
+
+  /**
+   * Input: The replicate.
+   *
+   * Output: The replicate's config.
+   *
+   * Purpose: To get the config of one replicate.
+   */
+  SymConfigBase & GetConfig(size_t n) {return *configs[n];}
+
+  /**
+   * Input: The function to call with each replicate's world and config.
+   *
+   * Output: None
+   *
+   * Purpose: To do the same thing to every replicate, running up to one
+   * replicate per hardware thread at a time. Replicates share no state, so
+   * each one gives the same results as it would on its own.
+   */
+  void ForEachReplicate(const std::function<void(WORLD &, SymConfigBase &)> & fun) {
+    std::atomic<size_t> next_replicate(0);
+    auto worker = [&]() {
+      for (size_t n = next_replicate++; n < worlds.size(); n = next_replicate++) {
+        fun(*worlds[n], *configs[n]);
+      }
+    };
+    emp::vector<std::thread> threads;
+    for (size_t t = 1; t < num_workers; t++) threads.emplace_back(worker);
+    worker();
+    for (std::thread & thread : threads) thread.join();
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To set up every replicate's world and data files.
+   */
+  void Setup() {
+    ForEachReplicate([](WORLD & world, SymConfigBase &) {
+      world.Setup();
+      world.CreateDataFiles();
+    });
+  }
+
+  /**
+   * Input: Whether the replicates should be reported as they finish.
+   *
+   * Output: None
+   *
+   * Purpose: To run the experiment in every replicate.
+   */
+  void RunExperiment(bool verbose=true) {
+    std::mutex output_mutex;
+    ForEachReplicate([&](WORLD & world, SymConfigBase & config) {
+      world.RunExperiment(false);
+      if (verbose) {
+        std::unique_lock<std::mutex> lock(output_mutex);
+        std::cout << "Replicate with seed " << config.SEED() << " finished" << std::endl;
+      }
+    });
+  }
+};
+#endif
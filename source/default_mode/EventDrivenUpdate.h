@@ -0,0 +1,363 @@
+#ifndef EVENT_DRIVEN_UPDATE_H
+#define EVENT_DRIVEN_UPDATE_H
+
+#include "../../Empirical/include/emp/base/Ptr.hpp"
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include "../../Empirical/include/emp/math/random_utils.hpp"
+#include "../Organism.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <queue>
+#include <utility>
+
+/**
+ * The event queue of an event-driven update (EVENT_DRIVEN 1). Each update
+ * only processes the cells whose next event falls in it; a cell whose host
+ * and symbionts gain the same points and age every update sleeps until its
+ * next reproduction, death or phage event, and the updates it skipped are
+ * filled in when it wakes or when the world needs the population as it
+ * stands (see CatchUpAllCells). The world wakes a cell whenever another
+ * cell changes it.
+ */
+class EventDrivenUpdate {
+public:
+  /**
+    *
+    * Purpose: Represents the wake update of a cell that is not in the queue,
+    * and of a phage event that has not been drawn.
+    *
+  */
+  static constexpr size_t NOT_SCHEDULED = (size_t) -1;
+
+  /**
+    *
+    * Purpose: Represents the most updates a cell is allowed to sleep for.
+    *
+  */
+  static constexpr size_t MAX_QUIET_UPDATES = 1000000000;
+
+private:
+  /**
+    *
+    * Purpose: Represent the event clock of each cell. A cell is processed in
+    * wake_update, and has been brought up to date through last_update. gains
+    * holds the points and age each of the cell's organisms (host first, then
+    * its symbionts) gained in the last update the cell was processed; steady
+    * is true when those gains repeated the ones from the update before, which
+    * is what allows updates in between to be skipped and filled in later. A
+    * lysogenic phage whose induction or loss was drawn for a skipped update
+    * is recorded in phage_update and phage_index.
+    *
+  */
+  struct OrgGain {
+    double points;
+    int age;
+  };
+  struct CellClock {
+    size_t last_update = 0;
+    size_t wake_update = NOT_SCHEDULED;
+    emp::Ptr<Organism> host = nullptr;
+    emp::vector<OrgGain> gains;
+    bool steady = false;
+    size_t phage_update = NOT_SCHEDULED;
+    size_t phage_index = 0;
+    bool phage_induces = false;
+  };
+  emp::vector<CellClock> cell_clocks;
+  std::priority_queue<std::pair<size_t, size_t>, emp::vector<std::pair<size_t, size_t>>,
+    std::greater<std::pair<size_t, size_t>>> cell_events;
+  bool events_started = false;
+  size_t cells_processed = 0;
+
+  /**
+    *
+    * Purpose: Represent the buffers an update is built in: the cells due this
+    * update, and the state of a cell before and after it is processed.
+    *
+  */
+  emp::vector<size_t> schedule;
+  emp::vector<std::pair<emp::Ptr<Organism>, OrgGain>> state_before;
+  emp::vector<std::pair<emp::Ptr<Organism>, OrgGain>> state_after;
+
+  /**
+   * Input: The location of the cell, the update it should be processed in,
+   * and the number of cells in the world.
+   *
+   * Output: None
+   *
+   * Purpose: To add an event for a cell to the event queue. Older events for
+   * the same cell stay in the queue and are skipped when they come up.
+   */
+  void ScheduleCell(size_t i, size_t update, size_t world_size) {
+    if (i >= cell_clocks.size()) cell_clocks.resize(world_size);
+    cell_clocks[i].wake_update = update;
+    cell_events.push(std::make_pair(update, i));
+  }
+
+  /**
+   * Input: The world, the location of the cell and the vector to fill.
+   *
+   * Output: None
+   *
+   * Purpose: To record the points and age of a cell's host and its symbionts.
+   */
+  template <typename WORLD>
+  static void GetCellState(WORLD & world, size_t i, emp::vector<std::pair<emp::Ptr<Organism>, OrgGain>> & state) {
+    state.resize(0);
+    if (!world.IsOccupied(i)) return;
+    emp::Ptr<Organism> host = world.GetOrgPtr(i);
+    state.push_back({host, {host->GetPoints(), host->GetAge()}});
+    for (emp::Ptr<Organism> sym : host->GetSymbionts()) {
+      state.push_back({sym, {sym->GetPoints(), sym->GetAge()}});
+    }
+  }
+
+  /**
+   * Input: The world, the location of the cell and the update to bring it up to.
+   *
+   * Output: None
+   *
+   * Purpose: To fill in the updates a cell skipped, by giving its host and
+   * symbionts the points and age they gained in the last update the cell was
+   * processed, once for each skipped update. A phage induction or loss drawn
+   * for the last of those updates is applied at the end.
+   */
+  template <typename WORLD>
+  void CatchUpCell(WORLD & world, size_t i, size_t update) {
+    CellClock & clock = cell_clocks[i];
+    if (clock.last_update >= update) return;
+    size_t skipped = update - clock.last_update;
+    clock.last_update = update;
+    if (!clock.steady || !world.IsOccupied(i) || world.GetOrgPtr(i) != clock.host) return;
+
+    emp::Ptr<Organism> host = world.GetOrgPtr(i);
+    SymbiontList & syms = host->GetSymbionts();
+    if (syms.size() + 1 != clock.gains.size()) return;
+    for (size_t j = 0; j < clock.gains.size(); j++) {
+      emp::Ptr<Organism> org = (j == 0) ? host : syms[j - 1];
+      org->AddPoints(clock.gains[j].points * skipped);
+      org->SetAge(org->GetAge() + clock.gains[j].age * (int) skipped);
+    }
+    if (clock.phage_update == update) {
+      emp::Ptr<Organism> phage = syms[clock.phage_index];
+      if (clock.phage_induces) {
+        phage->SetLysogeny(false);
+      } else { //the host became susceptible again
+        world.CountHost(host, -1);
+        syms.erase(syms.begin() + clock.phage_index);
+        world.CountHost(host, 1);
+        phage.Delete();
+      }
+      clock.phage_update = NOT_SCHEDULED;
+      clock.steady = false;
+    }
+  }
+
+  /**
+   * Input: The world, and the location of a cell that was just processed.
+   *
+   * Output: How many of the following updates the cell can skip.
+   *
+   * Purpose: To find the next event in a cell whose gains are steady: host
+   * reproduction or horizontal transmission once points reach the threshold,
+   * death of old age, or the induction or loss of a lysogenic phage, which is
+   * drawn from its chances per update. Cells with free-living symbionts,
+   * pending lysis, or lytic phage are processed every update, as are all cells
+   * when resources are limited or ectosymbiosis is on.
+   */
+  template <typename WORLD>
+  size_t GetQuietUpdates(WORLD & world, size_t i) {
+    CellClock & clock = cell_clocks[i];
+    SymConfigBase & config = *world.GetConfig();
+    clock.phage_update = NOT_SCHEDULED;
+    if (!clock.steady || world.HasLimitedResources() || config.ECTOSYMBIOSIS()) return 0;
+    if (!world.IsOccupied(i) || world.HasFreeSymAt(i)) return 0;
+    emp::Ptr<Organism> host = world.GetOrgPtr(i);
+    if (host->GetReproSymbionts().size() > 0) return 0;
+
+    SymbiontList & syms = host->GetSymbionts();
+    size_t quiet = MAX_QUIET_UPDATES;
+    size_t phage_steps = MAX_QUIET_UPDATES + 1;
+    for (size_t j = 0; j < clock.gains.size(); j++) {
+      emp::Ptr<Organism> org = (j == 0) ? host : syms[j - 1];
+      if (j > 0 && org->IsPhage()) {
+        if (!config.LYSIS()) continue;
+        if (!org->GetLysogeny()) return 0;
+        double induction = org->GetInductionChance();
+        double chance = induction + (1 - induction) * config.PROPHAGE_LOSS_RATE();
+        if (chance >= 1) return 0;
+        if (chance <= 0) continue;
+        double steps = 1 + std::floor(std::log(1.0 - world.GetRandom().GetDouble()) / std::log(1 - chance));
+        if (steps < phage_steps) {
+          phage_steps = (size_t) steps;
+          clock.phage_index = j - 1;
+          clock.phage_induces = world.GetRandom().P(induction / chance);
+        }
+        continue;
+      }
+
+      double threshold = (j == 0) ? config.HOST_REPRO_RES() : config.SYM_HORIZ_TRANS_RES();
+      if ((j == 0 || config.HORIZ_TRANS()) && clock.gains[j].points > 0) {
+        double steps = std::ceil((threshold - org->GetPoints()) / clock.gains[j].points);
+        if (steps <= 1) return 0;
+        if (steps <= MAX_QUIET_UPDATES) quiet = std::min(quiet, (size_t) steps - 1);
+      }
+      int age_max = (j == 0) ? config.HOST_AGE_MAX() : config.SYM_AGE_MAX();
+      if (age_max > 0 && clock.gains[j].age > 0) {
+        if (org->GetAge() >= age_max) return 0;
+        quiet = std::min(quiet, (size_t) (age_max - org->GetAge()));
+      }
+    }
+    //the phage event is applied once the cell has been brought up to its update
+    if (phage_steps <= quiet) {
+      clock.phage_update = world.GetUpdate() + phage_steps;
+      return phage_steps;
+    }
+    return quiet;
+  }
+
+  /**
+   * Input: The world, and the location of the cell.
+   *
+   * Output: None
+   *
+   * Purpose: To process a cell, measure what its organisms gained, and put the
+   * cell back in the event queue for the update of its next event.
+   */
+  template <typename WORLD>
+  void ProcessCellEvent(WORLD & world, size_t i) {
+    GetCellState(world, i, state_before);
+    world.ProcessCell(i);
+    cells_processed++;
+    GetCellState(world, i, state_after);
+
+    CellClock & clock = cell_clocks[i];
+    bool same_orgs = state_before.size() > 0 && state_before.size() == state_after.size();
+    bool steady = same_orgs && clock.host == state_after[0].first && clock.gains.size() == state_after.size();
+    for (size_t j = 0; same_orgs && j < state_after.size(); j++) {
+      OrgGain gain = {state_after[j].second.points - state_before[j].second.points,
+                      state_after[j].second.age - state_before[j].second.age};
+      //points are spent on reproduction, so gains are only steady between events
+      same_orgs = state_after[j].first == state_before[j].first && gain.points >= 0;
+      steady = steady && same_orgs && gain.age == clock.gains[j].age &&
+        std::abs(gain.points - clock.gains[j].points) <= 1e-9 * std::max(1.0, std::abs(gain.points));
+      if (j < clock.gains.size()) clock.gains[j] = gain;
+      else clock.gains.push_back(gain);
+    }
+    clock.gains.resize(same_orgs ? state_after.size() : 0);
+    clock.host = same_orgs ? state_after[0].first : nullptr;
+    clock.steady = steady && same_orgs;
+    clock.last_update = world.GetUpdate();
+
+    if (world.IsOccupied(i) || world.HasFreeSymAt(i)) {
+      ScheduleCell(i, world.GetUpdate() + 1 + GetQuietUpdates(world, i), world.GetSize());
+    } else {
+      clock.wake_update = NOT_SCHEDULED;
+    }
+  }
+
+public:
+  /**
+   * Input: None
+   *
+   * Output: The number of times a cell has been processed.
+   *
+   * Purpose: To report how much work the event queue has saved.
+   */
+  size_t GetCellsProcessed() const {return cells_processed;}
+
+  /**
+   * Input: The location of the cell.
+   *
+   * Output: The update in which the cell is next processed.
+   *
+   * Purpose: To look up a cell's place in the event queue.
+   */
+  size_t GetCellWakeUpdate(size_t i) const {
+    if (i >= cell_clocks.size()) return NOT_SCHEDULED;
+    return cell_clocks[i].wake_update;
+  }
+
+  /**
+   * Input: The world.
+   *
+   * Output: None
+   *
+   * Purpose: To bring every cell up to the current update, so that the
+   * population can be sampled.
+   */
+  template <typename WORLD>
+  void CatchUpAllCells(WORLD & world) {
+    if (!events_started) return;
+    for (size_t i : world.GetActiveCells()) CatchUpCell(world, i, world.GetUpdate());
+  }
+
+  /**
+   * Input: The world, and the location of a cell that another cell is about to change.
+   *
+   * Output: None
+   *
+   * Purpose: To bring a cell up to date before another cell places an organism
+   * in it or infects its host, and to make sure it is processed again in the
+   * next update, since its next event has changed.
+   */
+  template <typename WORLD>
+  void WakeCell(WORLD & world, size_t i) {
+    if (!events_started) return;
+    if (i >= cell_clocks.size()) cell_clocks.resize(world.GetSize());
+    size_t now = world.GetUpdate();
+    CellClock & clock = cell_clocks[i];
+    //a cell still waiting to be processed this update is only brought up to the last one
+    bool waiting = (clock.wake_update == now && clock.last_update < now);
+    CatchUpCell(world, i, waiting ? now - 1 : now);
+    clock.host = nullptr;
+    clock.gains.resize(0);
+    clock.steady = false;
+    clock.phage_update = NOT_SCHEDULED;
+    if (!waiting) ScheduleCell(i, now + 1, world.GetSize());
+  }
+
+  /**
+   * Input: The world.
+   *
+   * Output: None
+   *
+   * Purpose: To process only the cells whose events fall in this update.
+   * Occupied cells start in the event queue; every processed cell is put back
+   * for the update of its next event, and cells that other cells change are
+   * woken for the next update. The cells of an update are processed in random
+   * order, as in fixed updates, each drawing from its own stream when the
+   * world keys its random streams by cell (COUNTER_RNG).
+   */
+  template <typename WORLD>
+  void Run(WORLD & world) {
+    size_t now = world.GetUpdate();
+    if (cell_clocks.size() < world.GetSize()) cell_clocks.resize(world.GetSize());
+    if (!events_started) {
+      events_started = true;
+      for (size_t i : world.GetActiveCells()) {
+        cell_clocks[i].last_update = now - 1;
+        ScheduleCell(i, now, world.GetSize());
+      }
+    }
+
+    schedule.resize(0);
+    while (!cell_events.empty() && cell_events.top().first <= now) {
+      std::pair<size_t, size_t> event = cell_events.top();
+      cell_events.pop();
+      if (cell_clocks[event.second].wake_update == event.first) schedule.push_back(event.second);
+    }
+    std::sort(schedule.begin(), schedule.end());
+    schedule.erase(std::unique(schedule.begin(), schedule.end()), schedule.end());
+    emp::Shuffle(world.GetRandom(), schedule);
+
+    for (size_t i : schedule) {
+      if (world.GetConfig()->COUNTER_RNG()) world.UseCellStream(i);
+      CatchUpCell(world, i, now - 1);
+      ProcessCellEvent(world, i);
+    }
+    world.EndCellStream();
+  }
+};
+#endif
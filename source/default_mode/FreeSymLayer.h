@@ -0,0 +1,221 @@
+#ifndef FREE_SYM_LAYER_H
+#define FREE_SYM_LAYER_H
+
+#include "../../Empirical/include/emp/base/Ptr.hpp"
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include "../MemoryPolicy.h"
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+class Organism;
+
+/**
+ * The free-living symbionts of a world, at most one per cell. They are kept
+ * either densely, as a pointer per cell, or sparsely, as a bit per cell and
+ * a hash map from the occupied cells to their symbionts. When few cells hold
+ * a symbiont, the sparse form is smaller, and going through the symbionts
+ * costs in proportion to their number rather than to the size of the world.
+ * Both forms look up a cell in constant time and list the occupied cells in
+ * the same (cell) order, so the choice never changes results.
+ */
+class FreeSymLayer {
+public:
+  /**
+    *
+    * Purpose: Represents the fractions of occupied cells below which the
+    * layer becomes sparse and above which it becomes dense again. The gap
+    * keeps it from switching back and forth around a single density.
+    *
+  */
+  static constexpr double SPARSE_BELOW = 0.05;
+  static constexpr double DENSE_ABOVE = 0.1;
+
+private:
+  size_t num_cells = 0;
+  size_t count = 0;
+  bool sparse = false;
+
+  /**
+    *
+    * Purpose: Represents the symbionts in the dense form, one entry per cell.
+    *
+  */
+  emp::vector<emp::Ptr<Organism>> dense;
+
+  /**
+    *
+    * Purpose: Represents the symbionts in the sparse form: which cells are
+    * occupied, and the symbiont in each of them.
+    *
+  */
+  std::vector<bool> occupied;
+  std::unordered_map<size_t, emp::Ptr<Organism>> sparse_syms;
+
+public:
+  size_t size() const {return num_cells;}
+
+  /**
+   * Input: None
+   *
+   * Output: The number of cells that hold a symbiont.
+   *
+   * Purpose: To count the free-living symbionts.
+   */
+  size_t GetCount() const {return count;}
+
+  /**
+   * Input: None
+   *
+   * Output: Whether the layer is in its sparse form.
+   *
+   * Purpose: To check which form the layer is in.
+   */
+  bool IsSparse() const {return sparse;}
+
+  /**
+   * Input: The size_t location of a cell.
+   *
+   * Output: Whether the cell holds a symbiont.
+   *
+   * Purpose: To check a cell without fetching its symbiont.
+   */
+  bool Has(size_t i) const {return sparse ? (bool) occupied[i] : (bool) dense[i];}
+
+  /**
+   * Input: The size_t location of a cell.
+   *
+   * Output: The symbiont in the cell, or nullptr if it has none.
+   *
+   * Purpose: To get the symbiont in a cell.
+   */
+  emp::Ptr<Organism> operator[](size_t i) const {
+    if (!sparse) return dense[i];
+    if (!occupied[i]) return nullptr;
+    return sparse_syms.find(i)->second;
+  }
+
+  /**
+   * Input: The size_t location of a cell, and the symbiont to put in it
+   * (or nullptr to empty it).
+   *
+   * Output: None
+   *
+   * Purpose: To set the symbiont in a cell. Whatever the cell held before
+   * is forgotten, not deleted.
+   */
+  void Set(size_t i, emp::Ptr<Organism> sym) {
+    bool had_sym = Has(i);
+    if (!sparse) {
+      dense[i] = sym;
+    } else if (sym) {
+      occupied[i] = true;
+      sparse_syms[i] = sym;
+    } else if (had_sym) {
+      occupied[i] = false;
+      sparse_syms.erase(i);
+    }
+    if (had_sym) count--;
+    if (sym) count++;
+  }
+
+  /**
+   * Input: The new number of cells.
+   *
+   * Output: None
+   *
+   * Purpose: To resize the layer. Symbionts in cells that are cut off are
+   * forgotten, not deleted, as with a vector.
+   */
+  void resize(size_t new_size) {
+    for (size_t i = new_size; i < num_cells; i++) {
+      if (Has(i)) Set(i, nullptr);
+    }
+    if (sparse) occupied.resize(new_size, false);
+    else {
+      MemoryPolicy::Reserve(dense, new_size);
+      dense.resize(new_size);
+    }
+    num_cells = new_size;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The cells that hold a symbiont, in increasing order.
+   *
+   * Purpose: To go through the free-living symbionts. In the sparse form
+   * this only touches the occupied cells.
+   */
+  emp::vector<size_t> GetOccupiedCells() const {
+    emp::vector<size_t> cells;
+    cells.reserve(count);
+    if (sparse) {
+      for (const auto & entry : sparse_syms) cells.push_back(entry.first);
+      std::sort(cells.begin(), cells.end());
+    } else {
+      for (size_t i = 0; i < num_cells; i++) {
+        if (dense[i]) cells.push_back(i);
+      }
+    }
+    return cells;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The bytes the layer's storage takes up. For the hash map this
+   * is an estimate: its buckets, and a node (the entry and a link) for each
+   * symbiont.
+   *
+   * Purpose: To account for the memory the layer takes up.
+   */
+  size_t GetBytes() const {
+    size_t node_bytes = sizeof(std::pair<const size_t, emp::Ptr<Organism>>) + sizeof(void *);
+    return sizeof(FreeSymLayer) + dense.capacity() * sizeof(emp::Ptr<Organism>)
+      + occupied.capacity() / 8 + sparse_syms.bucket_count() * sizeof(void *)
+      + sparse_syms.size() * node_bytes;
+  }
+
+  /**
+   * Input: Whether the layer should be sparse.
+   *
+   * Output: None
+   *
+   * Purpose: To move the symbionts into the other form.
+   */
+  void SetSparse(bool _in) {
+    if (_in == sparse) return;
+    if (_in) {
+      occupied.assign(num_cells, false);
+      sparse_syms.reserve(count);
+      for (size_t i = 0; i < num_cells; i++) {
+        if (!dense[i]) continue;
+        occupied[i] = true;
+        sparse_syms[i] = dense[i];
+      }
+      emp::vector<emp::Ptr<Organism>>().swap(dense);
+    } else {
+      MemoryPolicy::Reserve(dense, num_cells);
+      dense.assign(num_cells, nullptr);
+      for (const auto & entry : sparse_syms) dense[entry.first] = entry.second;
+      std::vector<bool>().swap(occupied);
+      std::unordered_map<size_t, emp::Ptr<Organism>>().swap(sparse_syms);
+    }
+    sparse = _in;
+  }
+
+  /**
+   * Input: Whether the sparse form may be used. It may not be when cells
+   * are processed on several threads, since its cells share storage.
+   *
+   * Output: None
+   *
+   * Purpose: To pick the form that suits the current density.
+   */
+  void ChooseForm(bool allow_sparse) {
+    if (!allow_sparse || (sparse && count > num_cells * DENSE_ABOVE)) SetSparse(false);
+    else if (!sparse && count < num_cells * SPARSE_BELOW) SetSparse(true);
+  }
+};
+#endif
@@ -0,0 +1,475 @@
+#ifndef GENOTYPE_COUNT_WORLD_H
+#define GENOTYPE_COUNT_WORLD_H
+
+#include "SymWorld.h"
+#include "Host.h"
+#include "Symbiont.h"
+#include <map>
+#include <tuple>
+
+class GenotypeCountWorld : public SymWorld {
+private:
+  /**
+    *
+    * Purpose: Represents the hosts of a genotype that have the same points,
+    * and whose symbionts (if they have them) have the same points.
+    *
+  */
+  struct Cohort {
+    double host_points;
+    double sym_points;
+    size_t count;
+  };
+
+  /**
+    *
+    * Purpose: Represents the hosts that share an interaction value and, if
+    * they have a symbiont, its interaction value and infection chance. Every
+    * member gains host_gain points each update, and its symbiont sym_gain,
+    * so the members only differ in how many points they have built up; the
+    * cohorts keep track of that.
+    *
+  */
+  struct Genotype {
+    double host_gain = 0;
+    double sym_gain = 0;
+    emp::vector<Cohort> cohorts;
+  };
+
+  /**
+    *
+    * Purpose: Represents a genotype by its host interaction value, whether
+    * it has a symbiont, and its symbiont's interaction value and infection
+    * chance (both 0 without a symbiont).
+    *
+  */
+  using genotype_key_t = std::tuple<double, bool, double, double>;
+
+  /**
+    *
+    * Purpose: Represents the population while the no-mutation updates run on
+    * counts, by genotype. Cells [0, number of hosts) are taken to hold the
+    * cohorts in order, genotype by genotype.
+    *
+  */
+  std::map<genotype_key_t, Genotype> genotypes;
+
+  /**
+    *
+    * Purpose: Represents the offspring of an update, by genotype, until they
+    * are placed.
+    *
+  */
+  struct Births {
+    genotype_key_t key;
+    Cohort cohort;
+  };
+  emp::vector<Births> host_births;
+  emp::vector<Births> sym_births;
+
+  /**
+    *
+    * Purpose: Represents whether the no-mutation updates are running on the
+    * genotype counts, in which case pop only shows the population when it
+    * has been rebuilt for the data files.
+    *
+  */
+  bool aggregated = false;
+
+  /**
+    *
+    * Purpose: Represents the generator handed to the organisms built from the
+    * counts (to work out the gains, and to rebuild pop), so that building
+    * them never uses up draws from the world's generator.
+    *
+  */
+  emp::Random store_random;
+
+public:
+  GenotypeCountWorld(emp::Random & _random, emp::Ptr<SymConfigBase> _config) : SymWorld(_random, _config), store_random(1) {}
+
+  /**
+   * Input: None.
+   *
+   * Output: Whether the no-mutation updates can be run on genotype counts.
+   *
+   * Purpose: To check that aggregation is turned on (AGGREGATE_NO_MUT 1) and that
+   * the world is one the genotype-count engine models exactly: a well-mixed world
+   * of default-mode hosts carrying at most one symbiont, without free-living
+   * symbionts, ectosymbiosis, limited resources, age limits, phylogenies,
+   * or the event-driven and synchronous update modes.
+   */
+  bool CanAggregateGenotypes() {
+    if (!my_config->AGGREGATE_NO_MUT()) return false;
+    if (my_config->GRID() || my_config->FREE_LIVING_SYMS() || my_config->ECTOSYMBIOSIS()) return false;
+    if (my_config->PHYLOGENY() || total_res != -1 || my_config->SYM_LIMIT() != 1) return false;
+    if (my_config->HOST_AGE_MAX() != -1 || my_config->SYM_AGE_MAX() != -1) return false;
+    if (my_config->EVENT_DRIVEN() || my_config->SYNCHRONOUS()) return false;
+
+    for (size_t i = 0; i < pop.size(); i++) {
+      if (!pop[i]) continue;
+      if (pop[i]->GetName() != "Host" || pop[i]->GetReproSymbionts().size() > 0) return false;
+      for (emp::Ptr<Organism> sym : pop[i]->GetSymbionts()) {
+        if (sym->GetName() != "Symbiont") return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * Input: None.
+   *
+   * Output: Whether the no-mutation updates are running on genotype counts.
+   *
+   * Purpose: To check whether AggregateGenotypes has taken over the population.
+   */
+  bool IsAggregated() {return aggregated;}
+
+  /**
+   * Input: None.
+   *
+   * Output: The number of genotypes, and of cohorts over all genotypes.
+   *
+   * Purpose: To report how far the population has been collapsed. Each
+   * update costs about as much per cohort as the organism objects cost per
+   * host, so counts only pay off when there are a lot fewer cohorts than hosts.
+   */
+  size_t GetGenotypeCount() {return genotypes.size();}
+  size_t GetCohortCount() {
+    size_t count = 0;
+    for (auto & entry : genotypes) count += entry.second.cohorts.size();
+    return count;
+  }
+
+  /**
+   * Input: None.
+   *
+   * Output: The number of hosts the counts hold.
+   *
+   * Purpose: To total the cohorts.
+   */
+  size_t GetHostCount() {
+    size_t count = 0;
+    for (auto & entry : genotypes) {
+      for (Cohort & cohort : entry.second.cohorts) count += cohort.count;
+    }
+    return count;
+  }
+
+  /**
+   * Input: The genotype.
+   *
+   * Output: The genotype's entry, added (with its gains worked out) if it is new.
+   *
+   * Purpose: To look up a genotype. The points a host and its symbiont gain
+   * from an update's resources are worked out once per genotype, by letting
+   * a stand-in host distribute them.
+   */
+  Genotype & GetGenotype(const genotype_key_t & key) {
+    auto found = genotypes.find(key);
+    if (found != genotypes.end()) return found->second;
+
+    Genotype & genotype = genotypes[key];
+    Host host(&store_random, this, my_config, std::get<0>(key));
+    emp::Ptr<Symbiont> sym = nullptr;
+    if (std::get<1>(key)) {
+      sym = emp::NewPtr<Symbiont>(&store_random, this, my_config, std::get<2>(key));
+      host.AddSymbiont(sym);
+    }
+    host.DistribResources(my_config->RES_DISTRIBUTE());
+    genotype.host_gain = host.GetPoints();
+    genotype.sym_gain = sym ? sym->GetPoints() : 0.0;
+    return genotype;
+  }
+
+  /**
+   * Input: None.
+   *
+   * Output: Whether the population was collapsed into counts.
+   *
+   * Purpose: To collapse the population into genotype counts. The organisms
+   * stay in pop until ExpandGenotypes replaces them. If there would be more
+   * than half as many cohorts as hosts (e.g. after mutation has made nearly
+   * every host's genotype unique), the counts can't beat the organisms, so
+   * the population is left as it is.
+   */
+  bool AggregateGenotypes() {
+    genotypes.clear();
+    size_t num_hosts = 0;
+    for (size_t i = 0; i < pop.size(); i++) {
+      if (!pop[i]) continue;
+      genotype_key_t key(pop[i]->GetIntVal(), false, 0, 0);
+      Cohort cohort = {pop[i]->GetPoints(), 0, 1};
+      if (pop[i]->HasSym()) {
+        emp::Ptr<Organism> sym = pop[i]->GetSymbionts()[0];
+        key = genotype_key_t(pop[i]->GetIntVal(), true, sym->GetIntVal(), sym->GetInfectionChance());
+        cohort.sym_points = sym->GetPoints();
+      }
+      GetGenotype(key).cohorts.push_back(cohort);
+      num_hosts++;
+    }
+    MergeGenotypes();
+    aggregated = GetCohortCount() <= num_hosts / 2;
+    if (!aggregated) genotypes.clear();
+    return aggregated;
+  }
+
+  /**
+   * Input: None.
+   *
+   * Output: None.
+   *
+   * Purpose: To rebuild pop from the genotype counts, so that the data files
+   * (and anything run after the no-mutation updates) see ordinary organisms.
+   * Cell positions carry no meaning in a well-mixed world, so the cohorts are
+   * laid out from the first cell on.
+   */
+  void ExpandGenotypes() {
+    size_t pos = 0;
+    for (auto & entry : genotypes) {
+      const genotype_key_t & key = entry.first;
+      for (Cohort & cohort : entry.second.cohorts) {
+        for (size_t i = 0; i < cohort.count; i++) {
+          emp::Ptr<Host> host = emp::NewPtr<Host>(&store_random, this, my_config, std::get<0>(key),
+            emp::vector<emp::Ptr<Organism>>(), emp::vector<emp::Ptr<Organism>>(), cohort.host_points);
+          if (std::get<1>(key)) {
+            emp::Ptr<Symbiont> sym = emp::NewPtr<Symbiont>(&store_random, this, my_config, std::get<2>(key), cohort.sym_points);
+            sym->SetInfectionChance(std::get<3>(key));
+            host->AddSymbiont(sym);
+          }
+          AddOrgAt(host, emp::WorldPosition(pos++));
+        }
+      }
+    }
+    for (; pos < pop.size(); pos++) {
+      if (pop[pos]) DoDeath(pos);
+    }
+  }
+
+  /**
+   * Input: None.
+   *
+   * Output: None.
+   *
+   * Purpose: To sort each genotype's cohorts by their points and combine the
+   * ones that are identical, dropping cohorts and genotypes that have no
+   * members left.
+   */
+  void MergeGenotypes() {
+    auto by_points = [](const Cohort & a, const Cohort & b) {
+      return std::tie(a.host_points, a.sym_points) < std::tie(b.host_points, b.sym_points);
+    };
+    for (auto it = genotypes.begin(); it != genotypes.end();) {
+      emp::vector<Cohort> & cohorts = it->second.cohorts;
+      std::sort(cohorts.begin(), cohorts.end(), by_points);
+      size_t kept = 0;
+      for (size_t i = 0; i < cohorts.size(); i++) {
+        if (cohorts[i].count == 0) continue;
+        if (kept > 0 && !by_points(cohorts[kept - 1], cohorts[i])) {
+          cohorts[kept - 1].count += cohorts[i].count;
+        } else {
+          cohorts[kept++] = cohorts[i];
+        }
+      }
+      cohorts.resize(kept);
+      if (kept == 0) it = genotypes.erase(it);
+      else ++it;
+    }
+  }
+
+  /**
+   * Input: The landing spots to fill (one per offspring, holding the index
+   * of its births entry), and the number of cells they can land in.
+   *
+   * Output: None
+   *
+   * Purpose: To draw where each offspring lands: they are put in a random
+   * order, each draws a uniformly random cell, and they are then sorted by
+   * cell, keeping that order within a cell.
+   */
+  void DrawLandings(emp::vector<std::pair<size_t, size_t>> & landings, size_t num_cells) {
+    emp::Shuffle(GetRandom(), landings);
+    for (auto & landing : landings) landing.first = GetRandom().GetUInt(num_cells);
+    std::stable_sort(landings.begin(), landings.end(),
+      [](const std::pair<size_t, size_t> & a, const std::pair<size_t, size_t> & b) {return a.first < b.first;});
+  }
+
+  /**
+   * Input: None.
+   *
+   * Output: None.
+   *
+   * Purpose: To advance the genotype counts by one update, following the rules
+   * of Host::Process and Symbiont::Process for a whole cohort at once: every
+   * member gains the same points, so a cohort reproduces together and only
+   * splits where a random draw (vertical transmission, or where an offspring
+   * lands) tells its members apart. Offspring land in uniformly random cells,
+   * with the last one to land in a cell keeping it, and symbiont offspring try
+   * to infect a uniformly random host, with only the first one to reach an
+   * uninfected host getting in. All the offspring of an update are placed once
+   * every cohort has been processed.
+   */
+  void StepGenotypes() {
+    double host_repro_res = my_config->HOST_REPRO_RES();
+    double horiz_res = my_config->SYM_HORIZ_TRANS_RES();
+    double vert_res = my_config->SYM_VERT_TRANS_RES();
+    //symbiont points only matter when something is checked against them
+    bool track_sym_points = my_config->HORIZ_TRANS() || vert_res > 0;
+
+    host_births.clear();
+    sym_births.clear();
+    for (auto & entry : genotypes) {
+      const genotype_key_t & key = entry.first;
+      Genotype & genotype = entry.second;
+      bool has_sym = std::get<1>(key);
+      size_t num_cohorts = genotype.cohorts.size();
+      for (size_t c = 0; c < num_cohorts; c++) {
+        Cohort & cohort = genotype.cohorts[c];
+        cohort.host_points += genotype.host_gain;
+        if (has_sym && track_sym_points) cohort.sym_points += genotype.sym_gain;
+        if (cohort.host_points < host_repro_res) continue;
+
+        cohort.host_points = 0;
+        size_t transmitted = 0;
+        if (has_sym && cohort.sym_points >= vert_res) {
+          transmitted = GetRandom().GetRandBinomial(cohort.count, my_config->VERTICAL_TRANSMISSION());
+        }
+        if (transmitted > 0) {
+          cohort.count -= transmitted;
+          genotype.cohorts.push_back({0, cohort.sym_points - vert_res, transmitted});
+          host_births.push_back({key, {0, 0, transmitted}});
+          emp::DataMonitor<int>& data_node_attempts_verttrans = GetVerticalTransmissionAttemptCount();
+          for (size_t j = 0; j < transmitted; j++) data_node_attempts_verttrans.AddDatum(1);
+        }
+        //cohort is not used past here, since push_back may have moved it
+        host_births.push_back({genotype_key_t(std::get<0>(key), false, 0, 0), {0, 0, genotype.cohorts[c].count}});
+      }
+    }
+
+    //symbionts (including the parents split off above) transmit horizontally
+    if (my_config->HORIZ_TRANS()) {
+      for (auto & entry : genotypes) {
+        if (!std::get<1>(entry.first)) continue;
+        for (Cohort & cohort : entry.second.cohorts) {
+          if (cohort.count == 0 || cohort.sym_points < horiz_res) continue;
+          cohort.sym_points = 0;
+          sym_births.push_back({entry.first, {0, 0, cohort.count}});
+        }
+      }
+    }
+
+    //place the host offspring, each replacing the host in the cell it lands in
+    emp::vector<std::pair<size_t, size_t>> landings;
+    for (size_t b = 0; b < host_births.size(); b++) {
+      for (size_t j = 0; j < host_births[b].cohort.count; j++) landings.emplace_back(0, b);
+      host_births[b].cohort.count = 0;
+    }
+    DrawLandings(landings, GetSize());
+    auto genotype_it = genotypes.begin();
+    size_t cohort_id = 0;
+    size_t cohort_end = genotypes.empty() ? 0 : genotype_it->second.cohorts[0].count;
+    for (size_t j = 0; j < landings.size(); j++) {
+      if (j + 1 < landings.size() && landings[j + 1].first == landings[j].first) continue; //a later offspring takes the cell
+      size_t cell = landings[j].first;
+      while (genotype_it != genotypes.end() && cell >= cohort_end) {
+        if (++cohort_id == genotype_it->second.cohorts.size()) {
+          cohort_id = 0;
+          ++genotype_it;
+        }
+        if (genotype_it != genotypes.end()) cohort_end += genotype_it->second.cohorts[cohort_id].count;
+      }
+      if (genotype_it != genotypes.end()) genotype_it->second.cohorts[cohort_id].count--; //the host in the cell is replaced
+      host_births[landings[j].second].cohort.count++;
+    }
+    for (Births & births : host_births) GetGenotype(births.key).cohorts.push_back(births.cohort);
+    MergeGenotypes();
+
+    //infect: every symbiont offspring aims at a random host
+    size_t num_hosts = GetHostCount();
+    landings.clear();
+    for (size_t b = 0; b < sym_births.size(); b++) {
+      for (size_t j = 0; j < sym_births[b].cohort.count; j++) landings.emplace_back(0, b);
+    }
+    emp::DataMonitor<int>& data_node_attempts_horiztrans = GetHorizontalTransmissionAttemptCount();
+    emp::DataMonitor<int>& data_node_successes_horiztrans = GetHorizontalTransmissionSuccessCount();
+    for (size_t j = 0; j < landings.size(); j++) data_node_attempts_horiztrans.AddDatum(1);
+    if (num_hosts == 0) return;
+    DrawLandings(landings, num_hosts);
+    host_births.clear(); //now the hosts that move to a genotype with a symbiont
+    genotype_it = genotypes.begin();
+    cohort_id = 0;
+    cohort_end = genotype_it->second.cohorts[0].count;
+    for (size_t j = 0; j < landings.size(); j++) {
+      if (j > 0 && landings[j - 1].first == landings[j].first) continue; //the host was reached first by another
+      size_t target = landings[j].first;
+      while (target >= cohort_end) {
+        if (++cohort_id == genotype_it->second.cohorts.size()) {
+          cohort_id = 0;
+          ++genotype_it;
+        }
+        cohort_end += genotype_it->second.cohorts[cohort_id].count;
+      }
+      if (std::get<1>(genotype_it->first)) continue; //the host is full
+      const genotype_key_t & sym = sym_births[landings[j].second].key;
+      Cohort & host = genotype_it->second.cohorts[cohort_id];
+      host.count--;
+      host_births.push_back({genotype_key_t(std::get<0>(genotype_it->first), true, std::get<2>(sym), std::get<3>(sym)),
+        {host.host_points, 0, 1}});
+      data_node_successes_horiztrans.AddDatum(1);
+    }
+    for (Births & births : host_births) GetGenotype(births.key).cohorts.push_back(births.cohort);
+    MergeGenotypes();
+  }
+
+  /**
+   * Input: None.
+   *
+   * Output: None.
+   *
+   * Purpose: To rebuild pop from the counts just before the data monitors
+   * are recomputed, which is when a data file is about to print, so that
+   * the files report the population the counts hold at that moment.
+   */
+  void CollectStats() override {
+    if (aggregated) ExpandGenotypes();
+    SymWorld::CollectStats();
+  }
+
+  /**
+   * Input: None.
+   *
+   * Output: None.
+   *
+   * Purpose: To run one aggregated no-mutation update.
+   */
+  void UpdateGenotypes() {
+    emp::World<Organism>::Update();
+    StepGenotypes();
+  }
+
+  /**
+   * Input: The number of no-mutation updates, and whether progress should be printed.
+   *
+   * Output: None.
+   *
+   * Purpose: To run the no-mutation updates on genotype counts when the
+   * world allows it (see CanAggregateGenotypes and AggregateGenotypes), and
+   * on the organisms otherwise, leaving the final population in pop.
+   */
+  void RunNoMutUpdates(int num_updates, bool verbose) override {
+    if (num_updates <= 0 || !CanAggregateGenotypes() || !AggregateGenotypes()) {
+      SymWorld::RunNoMutUpdates(num_updates, verbose);
+      return;
+    }
+    for (int i = 0; i < num_updates; i++) {
+      if(verbose && (i%my_config->DATA_INT())==0) {
+        std::cout <<"No mutation update: "<< i << std::endl;
+        std::cout.flush();
+      }
+      UpdateGenotypes();
+    }
+    ExpandGenotypes();
+    aggregated = false;
+  }
+}; //end of GenotypeCountWorld class
+#endif
@@ -22,7 +22,7 @@ protected:
     * one represents mutualism. Zero is a neutral value.
     *
   */
-  double interaction_val = 0;
+  trait_t interaction_val = 0;
 
   /**
     *
@@ -39,7 +39,7 @@ protected:
     * added with AddSymbiont(). This can be cleared with ClearSyms()
     *
   */
-  emp::vector<emp::Ptr<Organism>> syms = {};
+  SymbiontList syms = {};
 
   /**
     *
@@ -47,7 +47,7 @@ protected:
     * Symbionts can be added with AddReproSymb(). This can be cleared with ClearSyms()
     *
   */
-  emp::vector<emp::Ptr<Organism>> repro_syms = {};
+  SymbiontList repro_syms = {};
 
   /**
     *
@@ -67,31 +67,26 @@ protected:
 
   /**
     *
-    * Purpose: Represents an instance of random.
+    * Purpose: Represents the random number generator, world and configuration
+    * settings the host lives with, which are shared by every organism of its world.
     *
   */
-  emp::Ptr<emp::Random> random = NULL;
+  emp::Ptr<OrganismContext> context = NULL;
 
   /**
     *
-    * Purpose: Represents the world that the hosts are living in.
-    *
-  */
-  emp::Ptr<SymWorld> my_world = NULL;
-
-  /**
-    *
-    * Purpose: Represents the configuration settings for a particular run.
+    * Purpose: Represents if a host is alive. This is set to true when a host is killed.
     *
   */
-  emp::Ptr<SymConfigBase> my_config = NULL;
+  bool dead = false;
 
   /**
     *
-    * Purpose: Represents if a host is alive. This is set to true when a host is killed.
+    * Purpose: Represents if a host is in its world's population, so that
+    * changes to its symbionts are counted (see SymWorld::CountHost).
     *
   */
-  bool dead = false;
+  bool in_world = false;
 
 public:
 
@@ -101,11 +96,12 @@ public:
   Host(emp::Ptr<emp::Random> _random, emp::Ptr<SymWorld> _world, emp::Ptr<SymConfigBase> _config,
   double _intval =0.0, emp::vector<emp::Ptr<Organism>> _syms = {},
   emp::vector<emp::Ptr<Organism>> _repro_syms = {},
-  double _points = 0.0) : interaction_val(_intval), syms(_syms), repro_syms(_repro_syms), points(_points), random(_random), my_world(_world), my_config(_config) {
+  double _points = 0.0) : interaction_val(_intval), syms(_syms), repro_syms(_repro_syms), points(_points),
+  context(OrganismContext::Get(_random, _world, _config)) {
     if (_intval == -2) {
-      interaction_val = random->GetDouble(-1, 1);
+      interaction_val = GetRandom().GetDouble(-1, 1);
     }
-    if (interaction_val > 1 || interaction_val < -1) {
+    else if (_intval > 1 || _intval < -1) {
        throw "Invalid interaction value. Must be between -1 and 1";  // Exception for invalid interaction value
      };
    }
@@ -198,6 +194,35 @@ public:
   bool operator!=(const Host &other) const {return !(*this == other);}
 
 
+  /**
+   * Input: None
+   *
+   * Output: The random number generator the host should draw from.
+   *
+   * Purpose: To draw from the world's tile or cell stream while the world is
+   * processing tiles or using COUNTER_RNG, and from the host's own generator otherwise.
+   */
+  emp::Random & GetRandom() { return SymWorld::GetThreadRandom(context->random); }
+
+  /**
+   * Input: None
+   *
+   * Output: The world the host lives in.
+   *
+   * Purpose: To get the host's world.
+   */
+  emp::Ptr<SymWorld> GetWorld() {return context->world;}
+
+  /**
+   * Input: None
+   *
+   * Output: The configuration settings for the run.
+   *
+   * Purpose: To get the host's configuration settings.
+   */
+  emp::Ptr<SymConfigBase> GetConfig() {return context->config;}
+
+
   /**
   * Input: None
   * 
@@ -209,6 +234,17 @@ public:
     return  "Host";
   }
 
+  /**
+  * Input: None
+  *
+  * Output: The size in bytes of a Host object
+  *
+  * Purpose: To account for the memory organisms take up by their exact type
+  */
+  size_t GetObjectSize() {
+    return sizeof(Host);
+  }
+
 /**
   * Input: None
   *
@@ -216,7 +252,7 @@ public:
   *
   * Purpose: To get the double representing host's interaction value
   */
-  double GetIntVal() const { return interaction_val;}
+  double GetIntVal() const final { return interaction_val;}
 
 
 /**
@@ -226,7 +262,7 @@ public:
   *
   * Purpose: To get the vector containing pointers to the host's symbionts.
   */
-  emp::vector<emp::Ptr<Organism>>& GetSymbionts() {return syms;}
+  SymbiontList& GetSymbionts() final {return syms;}
 
 
 /**
@@ -236,7 +272,7 @@ public:
  *
  * Purpose: To get the vector containing pointers to the host's repro syms.
  */
-  emp::vector<emp::Ptr<Organism>>& GetReproSymbionts() {return repro_syms;}
+  SymbiontList& GetReproSymbionts() final {return repro_syms;}
 
 
   /**
@@ -246,7 +282,7 @@ public:
    *
    * Purpose: To get the host's points.
    */
-  double GetPoints() { return points;}
+  double GetPoints() final { return points;}
 
 
   /**
@@ -256,7 +292,7 @@ public:
    *
    * Purpose: To get the value of res_in_process
    */
-  double GetResInProcess() { return res_in_process;}
+  double GetResInProcess() final { return res_in_process;}
 
   /**
    * Input: None
@@ -307,7 +343,7 @@ public:
    *
    * Purpose: To set a host's points.
    */
-  void SetPoints(double _in) {points = _in;}
+  void SetPoints(double _in) final {points = _in;}
 
 
   /**
@@ -317,7 +353,10 @@ public:
    *
    * Purpose: To clear a host's symbionts.
    */
-  void ClearSyms() {syms.resize(0);}
+  void ClearSyms() {
+    if (in_world) GetWorld()->CountHost(this, -1);
+    syms.resize(0);
+  }
 
 
   /**
@@ -337,7 +376,7 @@ public:
    *
    * Purpose: To kill a host.
    */
-  void SetDead() { dead = true;}
+  void SetDead() final { dead = true;}
 
 
   /**
@@ -347,7 +386,7 @@ public:
    *
    * Purpose: To set the value of res_in_process
    */
-  void SetResInProcess(double _in) { res_in_process = _in;}
+  void SetResInProcess(double _in) final { res_in_process = _in;}
 
   /**
    * Input: None
@@ -356,7 +395,25 @@ public:
    *
    * Purpose: To determine if a host is dead.
    */
-  bool GetDead() {return dead;}
+  bool GetDead() final {return dead;}
+
+  /**
+   * Input: None
+   *
+   * Output: boolean
+   *
+   * Purpose: To determine if a host is in its world's population.
+   */
+  bool IsInWorld() final {return in_world;}
+
+  /**
+   * Input: The bool representing if the host is in its world's population.
+   *
+   * Output: None
+   *
+   * Purpose: To mark a host as placed in or removed from its world.
+   */
+  void SetInWorld(bool _in) final {in_world = _in;}
 
   /**
    * Input: None
@@ -365,7 +422,7 @@ public:
    *
    * Purpose: To get the Host's age.
    */
-  int GetAge() {return age;}
+  int GetAge() final {return age;}
 
   /**
    * Input: An int of what age the Host should be set to
@@ -374,7 +431,7 @@ public:
    *
    * Purpose: To set the Host's age for testing purposes.
    */
-  void SetAge(int _in) {age = _in;}
+  void SetAge(int _in) final {age = _in;}
 
   /**
    * Input: None
@@ -383,9 +440,18 @@ public:
    *
    * Purpose: Increments age by one and kills it if too old.
    */
-  void GrowOlder(){
+  void GrowOlder(){GrowOlder(GetConfig()->HOST_AGE_MAX());}
+
+  /**
+   * Input: The maximum age hosts may reach (-1 for no limit).
+   *
+   * Output: None
+   *
+   * Purpose: Increments age by one and kills it if too old.
+   */
+  void GrowOlder(int age_max){
     age = age + 1;
-    if(age > my_config->HOST_AGE_MAX() && my_config->HOST_AGE_MAX() > 0){
+    if(age > age_max && age_max > 0){
       SetDead();
     }
   }
@@ -427,7 +493,7 @@ public:
    *
    * Purpose: To increment a host's points by the input value.
    */
-  void AddPoints(double _in) {points += _in;}
+  void AddPoints(double _in) final {points += _in;}
 
 
   /**
@@ -439,10 +505,12 @@ public:
    * Purpose: To add a symbionts to a host's symbionts
    */
   int AddSymbiont(emp::Ptr<Organism> _in) {
-    if((int)syms.size() < my_config->SYM_LIMIT() && SymAllowedIn()){
+    if((int)syms.size() < GetConfig()->SYM_LIMIT() && SymAllowedIn()){
+      if (in_world) GetWorld()->CountHost(this, -1);
       syms.push_back(_in);
       _in->SetHost(this);
       _in->UponInjection();
+      if (in_world) GetWorld()->CountHost(this, 1);
       return syms.size();
     } else {
       _in.Delete();
@@ -461,14 +529,14 @@ public:
    * where n is the number of existing phage.
    */
   bool SymAllowedIn(){
-    bool do_phage_exclusion = my_config->PHAGE_EXCLUDE();
+    bool do_phage_exclusion = GetConfig()->PHAGE_EXCLUDE();
     if(!do_phage_exclusion){
      return true;
     }
     else{
      int num_syms = syms.size();
      //essentially imitaties a 1/ 2^n chance, with n = number of symbionts
-     int enter_chance = random->GetUInt((int) pow(2.0, num_syms));
+     int enter_chance = GetRandom().GetUInt((int) pow(2.0, num_syms));
      if(enter_chance == 0) { return true; }
      return false;
     }
@@ -482,7 +550,7 @@ public:
    *
    * Purpose: To add a repro sym to the host's symbionts.
    */
-  void AddReproSym(emp::Ptr<Organism> _in) {repro_syms.push_back(_in);}
+  void AddReproSym(emp::Ptr<Organism> _in) final {repro_syms.push_back(_in);}
 
 
   /**
@@ -492,7 +560,7 @@ public:
    *
    * Purpose: To determine if a host has any symbionts, though they might be corpses that haven't been removed yet.
    */
-  bool HasSym() {
+  bool HasSym() final {
     return syms.size() != 0;
   }
 
@@ -504,7 +572,7 @@ public:
    * Purpose: To avoid creating an organism via constructor in other methods.
    */
   emp::Ptr<Organism> MakeNew(){
-    emp::Ptr<Host> new_host = emp::NewPtr<Host>(random, my_world, my_config, GetIntVal());
+    emp::Ptr<Host> new_host = emp::NewPtr<Host>(context->random, GetWorld(), GetConfig(), GetIntVal());
     return new_host;
   }
 
@@ -531,13 +599,13 @@ public:
    * hosts to allow for evolution to occur.
    */
   void Mutate(){
-    double mutation_size = my_config->HOST_MUTATION_SIZE();
-    if (mutation_size == -1) mutation_size = my_config->MUTATION_SIZE();
-    double mutation_rate = my_config->HOST_MUTATION_RATE();
-    if (mutation_rate == -1) mutation_rate = my_config->MUTATION_RATE();
+    double mutation_size = GetConfig()->HOST_MUTATION_SIZE();
+    if (mutation_size == -1) mutation_size = GetConfig()->MUTATION_SIZE();
+    double mutation_rate = GetConfig()->HOST_MUTATION_RATE();
+    if (mutation_rate == -1) mutation_rate = GetConfig()->MUTATION_RATE();
 
-    if(random->GetDouble(0.0, 1.0) <= mutation_rate){
-      interaction_val += random->GetRandNormal(0.0, mutation_size);
+    if(GetRandom().GetDouble(0.0, 1.0) <= mutation_rate){
+      interaction_val += GetRandom().GetRandNormal(0.0, mutation_size);
       if(interaction_val < -1) interaction_val = -1;
       else if (interaction_val > 1) interaction_val = 1;
     }
@@ -590,7 +658,7 @@ public:
     double leftover_resources = resources;
     if(GetDoEctosymbiosis(location)){
       double sym_piece = leftover_resources / (syms.size() + 1); //if there are no endo syms, the ecto sym will handle all the resources
-      DistribResToSym(my_world->GetSymAt(location), sym_piece);
+      DistribResToSym(GetWorld()->GetSymAt(location), sym_piece);
       leftover_resources = leftover_resources - sym_piece; //leave the leftover resources to be split by other syms
     }
     return leftover_resources;
@@ -605,10 +673,10 @@ public:
    */
   bool GetDoEctosymbiosis(size_t location){
     //a host is immune to ectosymbiosis if immunity is on and it has a sym.
-    if (!my_config->ECTOSYMBIOSIS()) return false; //if the config setting is off, we immediately know that ectosymbiosis won't happen
+    if (!GetConfig()->ECTOSYMBIOSIS()) return false; //if the config setting is off, we immediately know that ectosymbiosis won't happen
     else{
-      bool is_immune = my_config->ECTOSYMBIOTIC_IMMUNITY() && HasSym();
-      bool valid_sym = my_world->GetSymAt(location) != nullptr && !my_world->GetSymAt(location)->GetDead();
+      bool is_immune = GetConfig()->ECTOSYMBIOTIC_IMMUNITY() && HasSym();
+      bool valid_sym = GetWorld()->GetSymAt(location) != nullptr && !GetWorld()->GetSymAt(location)->GetDead();
       return (valid_sym == true) && (is_immune == false);
     }
   }
@@ -646,16 +714,31 @@ public:
    * Purpose: To process the host, meaning determining eligibility for reproduction, checking for vertical
    * transmission, removing dead syms, and processing alive syms.
    */
-  void Process(emp::WorldPosition pos) {
+  void Process(emp::WorldPosition pos) {ProcessWith<Organism>(pos, LiveParams(*GetConfig()));}
+
+  /**
+   * Input: The type of the host's symbionts (or Organism, if they can be of
+   * more than one type), the position of the host, and the settings to
+   * process it with.
+   *
+   * Output: None
+   *
+   * Purpose: To process the host as Process() does, with the calls that
+   * process its symbionts bound at compile time when their type is known,
+   * and the settings read from a snapshot when the world has frozen them.
+   */
+  template <typename SYM, typename PARAMS>
+  void ProcessWith(emp::WorldPosition pos, const PARAMS & params) {
     size_t location = pos.GetIndex();
     //Currently just wrapping to use the existing function
-    double desired_resources = my_config->RES_DISTRIBUTE();
-    double world_resources = my_world->PullResources(desired_resources); //recieve resources from the world
-    double resources = HandleEctosymbiosis(world_resources, location);
+    double desired_resources = params.ResDistribute();
+    double world_resources = GetWorld()->PullResources(desired_resources); //recieve resources from the world
+    double resources = world_resources;
+    if (params.Ectosymbiosis()) resources = HandleEctosymbiosis(world_resources, location);
     if(resources > 0) DistribResources(resources); //if there are enough resources left, distribute them.
 
     // Check reproduction
-    if (GetPoints() >= my_config->HOST_REPRO_RES() && repro_syms.size() == 0) {  // if host has more points than required for repro
+    if (GetPoints() >= params.HostReproRes() && repro_syms.size() == 0) {  // if host has more points than required for repro
         // will replicate & mutate a random offset from parent values
         // while resetting resource points for host and symbiont to zero
        emp::Ptr<Organism> host_baby = Reproduce();
@@ -665,15 +748,15 @@ public:
           emp::Ptr<Organism> parent = GetSymbionts()[j];
           parent->VerticalTransmission(host_baby);
         }
-        my_world->DoBirth(host_baby, location); //Automatically deals with grid
+        GetWorld()->DoBirth(host_baby, location); //Automatically deals with grid
       }
     if (GetDead()){
         return; //If host is dead, return
       }
     if (HasSym()) { //let each sym do whatever they need to do
-        emp::vector<emp::Ptr<Organism>>& syms = GetSymbionts();
+        SymbiontList& syms = GetSymbionts();
         for(size_t j = 0; j < syms.size(); j++){
-          emp::Ptr<Organism> curSym = syms[j];
+          emp::Ptr<SYM> curSym = syms[j].template Cast<SYM>();
           if (GetDead()){
             return; //If previous symbiont killed host, we're done
           }
@@ -681,15 +764,17 @@ public:
           //position in syms list + 1 as index (0 as fls index)
           emp::WorldPosition sym_pos = emp::WorldPosition(j+1, location);
           if(!curSym->GetDead()){
-            curSym->Process(sym_pos);
+            ProcessAs(curSym, sym_pos, params);
           }
           if(curSym->GetDead()){
+            if (in_world) GetWorld()->CountHost(this, -1);
             syms.erase(syms.begin() + j); //if the symbiont dies during their process, remove from syms list
+            if (in_world) GetWorld()->CountHost(this, 1);
             curSym.Delete();
           }
         } //for each sym in syms
       } //if org has syms
-    GrowOlder();
+    GrowOlder(params.HostAgeMax());
   }
 };//Host
 #endif
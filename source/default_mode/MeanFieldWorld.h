@@ -0,0 +1,555 @@
+#ifndef MEAN_FIELD_WORLD_H
+#define MEAN_FIELD_WORLD_H
+
+#include "SymWorld.h"
+#include "Host.h"
+#include "Symbiont.h"
+#include <cmath>
+
+class MeanFieldWorld : public SymWorld {
+private:
+  /**
+    *
+    * Purpose: Represents the number of interaction value bins, the same 20 bins
+    * of width 0.1 used by the histogram columns of the HostVals and SymVals files.
+    *
+  */
+  static constexpr size_t NUM_BINS = 20;
+
+  /**
+    *
+    * Purpose: Represents the expected number of uninfected hosts in each host
+    * interaction value bin, and of infected hosts in each pair of host and
+    * symbiont bins (indexed host bin * NUM_BINS + symbiont bin).
+    *
+  */
+  emp::vector<double> uninfected_hosts;
+  emp::vector<double> infected_hosts;
+
+  /**
+    *
+    * Purpose: Represents the points an uninfected host gains each update, and the
+    * points an infected host and its symbiont gain, for each bin (or pair of bins).
+    *
+  */
+  emp::vector<double> uninfected_gain;
+  emp::vector<double> host_gain;
+  emp::vector<double> sym_gain;
+
+  /**
+    *
+    * Purpose: Represents the chance that a host or symbiont offspring lands in
+    * each bin given its parent's bin (indexed parent bin * NUM_BINS + offspring bin).
+    *
+  */
+  emp::vector<double> host_mutation;
+  emp::vector<double> sym_mutation;
+
+  /**
+    *
+    * Purpose: Represents the number of cells in the well-mixed world.
+    *
+  */
+  double num_cells = 0;
+
+  /**
+    *
+    * Purpose: Buffers reused by every update for the distributions being built.
+    *
+  */
+  emp::vector<double> next_uninfected;
+  emp::vector<double> next_infected;
+  emp::vector<double> sym_offspring;
+
+  /**
+    *
+    * Purpose: Represents the expected numbers of horizontal transmission
+    * attempts and successes and of vertical transmission attempts since the
+    * start of the run, and how many of each the TransmissionRates file has
+    * been given so far (see AddExpectedCount).
+    *
+  */
+  double horiz_attempts = 0;
+  double horiz_successes = 0;
+  double vert_attempts = 0;
+  long horiz_attempts_written = 0;
+  long horiz_successes_written = 0;
+  long vert_attempts_written = 0;
+
+public:
+  using SymWorld::SymWorld;
+
+  /**
+   * Input: The bin.
+   *
+   * Output: The interaction value in the middle of the bin.
+   *
+   * Purpose: To find the interaction value that represents a bin.
+   */
+  static double GetBinCenter(size_t bin) {
+    return -1.0 + 0.1 * (bin + 0.5);
+  }
+
+  /**
+   * Input: The interaction value.
+   *
+   * Output: The bin the interaction value falls in.
+   *
+   * Purpose: To find the bin for an interaction value, with 1 in the top bin.
+   */
+  static size_t GetBin(double int_val) {
+    int bin = (int) std::floor((int_val + 1.0) * 10.0);
+    if (bin < 0) return 0;
+    if (bin >= (int) NUM_BINS) return NUM_BINS - 1;
+    return bin;
+  }
+
+  /**
+   * Input: The chance of mutation and the standard deviation of mutations.
+   *
+   * Output: The chance an offspring lands in each bin given its parent's bin.
+   *
+   * Purpose: To bin the mutation rules of Host::Mutate and Symbiont::Mutate:
+   * parents are spread evenly across their bin, and mutations past -1 or 1
+   * are clamped into the end bins.
+   */
+  static emp::vector<double> GetMutationKernel(double rate, double size) {
+    const size_t samples = 64;
+    emp::vector<double> kernel(NUM_BINS * NUM_BINS, 0.0);
+    for (size_t from = 0; from < NUM_BINS; from++) {
+      kernel[from * NUM_BINS + from] += 1.0 - rate;
+      if (rate <= 0) continue;
+      for (size_t k = 0; k < samples; k++) {
+        double parent = -1.0 + 0.1 * (from + (k + 0.5) / samples);
+        for (size_t to = 0; to < NUM_BINS; to++) {
+          double chance;
+          if (size <= 0) {
+            chance = (to == from) ? 1.0 : 0.0;
+          } else {
+            double low = (to == 0) ? -INFINITY : -1.0 + 0.1 * to;
+            double high = (to == NUM_BINS - 1) ? INFINITY : -1.0 + 0.1 * (to + 1);
+            chance = 0.5 * (std::erfc((low - parent) / (size * std::sqrt(2.0))) -
+                            std::erfc((high - parent) / (size * std::sqrt(2.0))));
+          }
+          kernel[from * NUM_BINS + to] += rate * chance / samples;
+        }
+      }
+    }
+    return kernel;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To build the mutation kernels from the current mutation settings.
+   */
+  void SetupMutationKernels() {
+    double host_size = my_config->HOST_MUTATION_SIZE();
+    if (host_size == -1) host_size = my_config->MUTATION_SIZE();
+    double host_rate = my_config->HOST_MUTATION_RATE();
+    if (host_rate == -1) host_rate = my_config->MUTATION_RATE();
+    host_mutation = GetMutationKernel(host_rate, host_size);
+    sym_mutation = GetMutationKernel(my_config->MUTATION_RATE(), my_config->MUTATION_SIZE());
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To find what hosts and symbionts in each bin gain each update, by
+   * giving a host (and symbiont) with the bin's interaction value RES_DISTRIBUTE
+   * resources through Host::DistribResources.
+   */
+  void SetupGains() {
+    uninfected_gain.resize(NUM_BINS);
+    host_gain.resize(NUM_BINS * NUM_BINS);
+    sym_gain.resize(NUM_BINS * NUM_BINS);
+    for (size_t h = 0; h < NUM_BINS; h++) {
+      Host host(&GetRandom(), this, my_config, GetBinCenter(h));
+      host.DistribResources(my_config->RES_DISTRIBUTE());
+      uninfected_gain[h] = std::max(0.0, host.GetPoints());
+      for (size_t s = 0; s < NUM_BINS; s++) {
+        emp::Ptr<Symbiont> sym = emp::NewPtr<Symbiont>(&GetRandom(), this, my_config, GetBinCenter(s));
+        Host infected(&GetRandom(), this, my_config, GetBinCenter(h), emp::vector<emp::Ptr<Organism>>{sym});
+        infected.DistribResources(my_config->RES_DISTRIBUTE());
+        host_gain[h * NUM_BINS + s] = std::max(0.0, infected.GetPoints());
+        sym_gain[h * NUM_BINS + s] = std::max(0.0, sym->GetPoints());
+      }
+    }
+  }
+
+  /**
+   * Input: The starting interaction value setting (-2 for random) and the vector to fill.
+   *
+   * Output: None
+   *
+   * Purpose: To spread a starting population of one across the bins.
+   */
+  static void GetStartingBins(double int_val, emp::vector<double> & bins) {
+    bins.assign(NUM_BINS, 0.0);
+    if (int_val == -2) {
+      for (double & bin : bins) bin = 1.0 / NUM_BINS;
+    } else {
+      bins[GetBin(int_val)] = 1.0;
+    }
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To set up the starting distributions from the same settings that
+   * SymWorld::Setup uses: POP_SIZE hosts and POP_SIZE * START_MOI symbionts,
+   * each symbiont landing in a random cell.
+   */
+  void Setup() {
+    num_cells = my_config->GRID_X() * my_config->GRID_Y();
+    double num_hosts = (my_config->POP_SIZE() == -1) ? num_cells : my_config->POP_SIZE();
+    double num_syms = num_hosts * my_config->START_MOI();
+    double infected_chance = 1.0 - std::pow(1.0 - 1.0 / num_cells, num_syms);
+
+    emp::vector<double> host_bins, sym_bins;
+    GetStartingBins(my_config->HOST_INT(), host_bins);
+    GetStartingBins(my_config->SYM_INT(), sym_bins);
+    uninfected_hosts.assign(NUM_BINS, 0.0);
+    infected_hosts.assign(NUM_BINS * NUM_BINS, 0.0);
+    for (size_t h = 0; h < NUM_BINS; h++) {
+      uninfected_hosts[h] = num_hosts * host_bins[h] * (1.0 - infected_chance);
+      for (size_t s = 0; s < NUM_BINS; s++) {
+        infected_hosts[h * NUM_BINS + s] = num_hosts * host_bins[h] * infected_chance * sym_bins[s];
+      }
+    }
+    SetupGains();
+    SetupMutationKernels();
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To step the distributions by one update with the rules of the
+   * agent-based model, as expected values. Hosts reproduce at their per-update
+   * gain over HOST_REPRO_RES, and offspring replace the occupant of a random
+   * cell. An infected parent's symbiont goes along with chance
+   * VERTICAL_TRANSMISSION. Symbionts transmit horizontally at their gain over
+   * SYM_HORIZ_TRANS_RES into a random host, infecting it if it is uninfected.
+   * HOST_AGE_MAX and SYM_AGE_MAX become death rates. Each host carries at most
+   * one symbiont.
+   */
+  void StepDistributions() {
+    double num_hosts = GetHostCount();
+    if (num_hosts <= 0) return;
+    double host_repro = my_config->HOST_REPRO_RES();
+    double sym_repro = my_config->SYM_HORIZ_TRANS_RES();
+    double vertical = my_config->VERTICAL_TRANSMISSION();
+
+    next_uninfected.assign(NUM_BINS, 0.0);
+    next_infected.assign(NUM_BINS * NUM_BINS, 0.0);
+    sym_offspring.assign(NUM_BINS, 0.0);
+
+    //host reproduction, with vertical transmission
+    double births = 0;
+    for (size_t h = 0; h < NUM_BINS; h++) {
+      double uninfected_births = uninfected_hosts[h] * uninfected_gain[h] / host_repro;
+      births += uninfected_births;
+      for (size_t child = 0; child < NUM_BINS; child++) {
+        next_uninfected[child] += uninfected_births * host_mutation[h * NUM_BINS + child];
+      }
+      for (size_t s = 0; s < NUM_BINS; s++) {
+        size_t pair = h * NUM_BINS + s;
+        double infected_births = infected_hosts[pair] * host_gain[pair] / host_repro;
+        births += infected_births;
+        //the symbiont needs SYM_VERT_TRANS_RES from one host generation
+        double transmits = vertical;
+        if (host_gain[pair] <= 0 || sym_gain[pair] * host_repro / host_gain[pair] < my_config->SYM_VERT_TRANS_RES()) {
+          transmits = 0;
+        }
+        vert_attempts += infected_births * transmits;
+        for (size_t child = 0; child < NUM_BINS; child++) {
+          double children = infected_births * host_mutation[h * NUM_BINS + child];
+          next_uninfected[child] += children * (1.0 - transmits);
+          for (size_t sym_child = 0; sym_child < NUM_BINS; sym_child++) {
+            next_infected[child * NUM_BINS + sym_child] += children * transmits * sym_mutation[s * NUM_BINS + sym_child];
+          }
+        }
+        if (my_config->HORIZ_TRANS() && sym_repro > 0) {
+          double sym_births = infected_hosts[pair] * sym_gain[pair] / sym_repro;
+          for (size_t sym_child = 0; sym_child < NUM_BINS; sym_child++) {
+            sym_offspring[sym_child] += sym_births * sym_mutation[s * NUM_BINS + sym_child];
+          }
+        }
+      }
+    }
+
+    //offspring replace the occupants of random cells
+    double survival = 1.0 - std::min(1.0, births / num_cells);
+    for (size_t h = 0; h < NUM_BINS; h++) {
+      uninfected_hosts[h] = uninfected_hosts[h] * survival + next_uninfected[h];
+      for (size_t s = 0; s < NUM_BINS; s++) {
+        size_t pair = h * NUM_BINS + s;
+        infected_hosts[pair] = infected_hosts[pair] * survival + next_infected[pair];
+      }
+    }
+
+    //horizontal transmission into random hosts, which only takes in uninfected ones
+    double total_sym_offspring = 0;
+    for (double offspring : sym_offspring) total_sym_offspring += offspring;
+    num_hosts = GetHostCount();
+    horiz_attempts += total_sym_offspring;
+    if (total_sym_offspring > 0 && num_hosts > 0) {
+      double infected_chance = 1.0 - std::exp(-total_sym_offspring / num_hosts);
+      for (size_t h = 0; h < NUM_BINS; h++) {
+        double newly_infected = uninfected_hosts[h] * infected_chance;
+        horiz_successes += newly_infected;
+        uninfected_hosts[h] -= newly_infected;
+        for (size_t s = 0; s < NUM_BINS; s++) {
+          infected_hosts[h * NUM_BINS + s] += newly_infected * sym_offspring[s] / total_sym_offspring;
+        }
+      }
+    }
+
+    //deaths of old age
+    double host_death = (my_config->HOST_AGE_MAX() > 0) ? 1.0 / my_config->HOST_AGE_MAX() : 0;
+    double sym_death = (my_config->SYM_AGE_MAX() > 0) ? 1.0 / my_config->SYM_AGE_MAX() : 0;
+    for (size_t h = 0; h < NUM_BINS; h++) {
+      uninfected_hosts[h] *= 1.0 - host_death;
+      for (size_t s = 0; s < NUM_BINS; s++) {
+        size_t pair = h * NUM_BINS + s;
+        infected_hosts[pair] *= 1.0 - host_death;
+        double lost_syms = infected_hosts[pair] * sym_death;
+        infected_hosts[pair] -= lost_syms;
+        uninfected_hosts[h] += lost_syms;
+      }
+    }
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The expected number of hosts.
+   *
+   * Purpose: To total the host distribution.
+   */
+  double GetHostCount() {
+    double count = GetUninfectedHostCount();
+    for (double hosts : infected_hosts) count += hosts;
+    return count;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The expected number of uninfected hosts.
+   *
+   * Purpose: To total the uninfected host distribution.
+   */
+  double GetUninfectedHostCount() {
+    double count = 0;
+    for (double hosts : uninfected_hosts) count += hosts;
+    return count;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The expected number of symbionts.
+   *
+   * Purpose: To total the symbiont distribution, one symbiont per infected host.
+   */
+  double GetSymCount() {
+    return GetHostCount() - GetUninfectedHostCount();
+  }
+
+  /**
+   * Input: The bin.
+   *
+   * Output: The expected number of hosts in the bin.
+   *
+   * Purpose: To read one bin of the host interaction value histogram.
+   */
+  double GetHostBinCount(size_t bin) {
+    double count = uninfected_hosts[bin];
+    for (size_t s = 0; s < NUM_BINS; s++) count += infected_hosts[bin * NUM_BINS + s];
+    return count;
+  }
+
+  /**
+   * Input: The bin.
+   *
+   * Output: The expected number of symbionts in the bin.
+   *
+   * Purpose: To read one bin of the symbiont interaction value histogram.
+   */
+  double GetSymBinCount(size_t bin) {
+    double count = 0;
+    for (size_t h = 0; h < NUM_BINS; h++) count += infected_hosts[h * NUM_BINS + bin];
+    return count;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The mean host interaction value, taking each bin at its center.
+   *
+   * Purpose: To average the host distribution.
+   */
+  double GetMeanHostIntVal() {
+    double total = 0;
+    for (size_t h = 0; h < NUM_BINS; h++) total += GetHostBinCount(h) * GetBinCenter(h);
+    return total / GetHostCount();
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The mean symbiont interaction value, taking each bin at its center.
+   *
+   * Purpose: To average the symbiont distribution.
+   */
+  double GetMeanSymIntVal() {
+    double total = 0;
+    for (size_t s = 0; s < NUM_BINS; s++) total += GetSymBinCount(s) * GetBinCenter(s);
+    return total / GetSymCount();
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The expected numbers of horizontal transmission attempts and
+   * successes, and of vertical transmission attempts, since the start of the run.
+   *
+   * Purpose: To read the transmission totals.
+   */
+  double GetHorizTransAttempts() {return horiz_attempts;}
+  double GetHorizTransSuccesses() {return horiz_successes;}
+  double GetVertTransAttempts() {return vert_attempts;}
+
+  /**
+   * Input: A transmission count monitor, the expected count since the start
+   * of the run, and how much of it the monitor has been given so far.
+   *
+   * Output: None
+   *
+   * Purpose: To give a monitor the whole transmissions expected since it was
+   * last given any. The running total is rounded rather than each update's
+   * share, so the counts the file prints add up to the rounded expected total.
+   */
+  static void AddExpectedCount(emp::DataMonitor<int> & node, double expected, long & written) {
+    long count = std::lround(expected) - written;
+    node.AddDatum((int) count);
+    written += count;
+  }
+
+  /**
+   * Input: The data file and the function giving the count in a bin.
+   *
+   * Output: None
+   *
+   * Purpose: To add the interaction value histogram columns, named as in
+   * SymWorld::SetupHostFileColumns, with the counts rounded to whole organisms.
+   */
+  void AddHistColumns(emp::DataFile & file, std::function<double(size_t)> bin_count) {
+    //bin edges in tenths, written as -1, -0.9, ..., 0.0, ..., 0.9, 1.0
+    auto edge = [](int tenths) {
+      if (tenths == -10) return std::string("-1");
+      if (tenths == 10) return std::string("1.0");
+      return std::string(tenths < 0 ? "-0." : "0.") + std::to_string(std::abs(tenths));
+    };
+    for (size_t bin = 0; bin < NUM_BINS; bin++) {
+      int low = (int) bin - 10;
+      std::string range = (bin == NUM_BINS - 1) ? " to " : " to <";
+      file.AddFun<long>([bin_count, bin](){ return std::lround(bin_count(bin)); }, "Hist_" + edge(low),
+        "Count for histogram bin " + edge(low) + range + edge(low + 1));
+    }
+  }
+
+  /**
+   * Input: None.
+   *
+   * Output: None.
+   *
+   * Purpose: To create the HostVals, SymVals and TransmissionRates files,
+   * with the same columns as the agent-based model's. Counts are the
+   * expected counts rounded to whole organisms (or transmissions), so the
+   * files can be read by the same scripts.
+   */
+  void CreateDataFiles() {
+    std::string file_ending = "_SEED"+std::to_string(my_config->SEED())+".data";
+
+    auto & host_file = SetupFile(my_config->FILE_PATH()+"HostVals"+my_config->FILE_NAME()+file_ending);
+    host_file.AddVar(update, "update", "Update");
+    host_file.AddFun<double>([this](){ return GetMeanHostIntVal(); }, "mean_intval", "Average host interaction value");
+    host_file.AddFun<long>([this](){ return std::lround(GetHostCount()); }, "count", "Total number of hosts");
+    host_file.AddFun<long>([this](){ return std::lround(GetUninfectedHostCount()); }, "uninfected_host_count", "Total number of hosts that are uninfected");
+    AddHistColumns(host_file, [this](size_t bin){ return GetHostBinCount(bin); });
+    host_file.PrintHeaderKeys();
+    host_file.SetTimingRepeat(my_config->DATA_INT());
+
+    auto & sym_file = SetupFile(my_config->FILE_PATH()+"SymVals"+my_config->FILE_NAME()+file_ending);
+    sym_file.AddVar(update, "update", "Update");
+    sym_file.AddFun<double>([this](){ return GetMeanSymIntVal(); }, "mean_intval", "Average symbiont interaction value");
+    sym_file.AddFun<long>([this](){ return std::lround(GetSymCount()); }, "count", "Total number of symbionts");
+    AddHistColumns(sym_file, [this](size_t bin){ return GetSymBinCount(bin); });
+    sym_file.PrintHeaderKeys();
+    sym_file.SetTimingRepeat(my_config->DATA_INT());
+
+    auto & transmission_file = SetUpTransmissionFile(my_config->FILE_PATH()+"TransmissionRates"+my_config->FILE_NAME()+file_ending);
+    transmission_file.AddPreFun([this](){
+      AddExpectedCount(GetHorizontalTransmissionAttemptCount(), horiz_attempts, horiz_attempts_written);
+      AddExpectedCount(GetHorizontalTransmissionSuccessCount(), horiz_successes, horiz_successes_written);
+      AddExpectedCount(GetVerticalTransmissionAttemptCount(), vert_attempts, vert_attempts_written);
+    });
+    transmission_file.SetTimingRepeat(my_config->DATA_INT());
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To simulate a timestep by stepping the distributions; the data
+   * files are written by the Empirical update as usual.
+   */
+  void Update() {
+    emp::World<Organism>::Update();
+    StepDistributions();
+  }
+
+  /**
+   * Input: Optional boolean "verbose" that specifies whether to print the update numbers to standard output or not, defaults to true.
+   *
+   * Output: None
+   *
+   * Purpose: Run the number of updates and non-mutation updates specified in the configuration settings.
+   */
+  void RunExperiment(bool verbose=true) {
+    int numupdates = my_config->UPDATES();
+    for (int i = 0; i < numupdates; i++) {
+      if(verbose && (i%my_config->DATA_INT())==0) {
+        std::cout <<"Update: "<< i << std::endl;
+        std::cout.flush();
+      }
+      Update();
+    }
+
+    int num_no_mut_updates = my_config->NO_MUT_UPDATES();
+    if(num_no_mut_updates > 0) {
+      SetMutationZero();
+      SetupMutationKernels();
+    }
+
+    for (int i = 0; i < num_no_mut_updates; i++) {
+      if(verbose && (i%my_config->DATA_INT())==0) {
+        std::cout <<"No mutation update: "<< i << std::endl;
+        std::cout.flush();
+      }
+      Update();
+    }
+  }
+}; //end of MeanFieldWorld class
+#endif
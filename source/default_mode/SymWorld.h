@@ -7,8 +7,26 @@
 #include "../../Empirical/include/emp/math/random_utils.hpp"
 #include "../../Empirical/include/emp/math/Random.hpp"
 #include "../Organism.h"
+#include "ActiveCells.h"
+#include "CellKernel.h"
+#include "EventDrivenUpdate.h"
+#include "FreeSymLayer.h"
+#include "SynchronousUpdate.h"
+#include "TiledUpdate.h"
+#include "../MemoryPolicy.h"
+#include "../MemoryReport.h"
 #include <set>
 #include <math.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <typeinfo>
+#include <unordered_set>
 
 
 class SymWorld : public emp::World<Organism>{
@@ -25,10 +43,21 @@ protected:
 
   /**
     *
-    * Purpose: Represents the free living sym environment, parallel to "pop" for hosts
+    * Purpose: Represents the free living sym environment, parallel to "pop" for hosts.
+    * It is kept sparse while few cells hold a symbiont (see FreeSymLayer.h).
     *
   */
-  pop_t sym_pop;
+  FreeSymLayer sym_pop;
+
+  /**
+    *
+    * Purpose: Represents whether the world has a free-living layer. Setup
+    * leaves it out when FREE_LIVING_SYMS is off, so sym_pop is left empty and
+    * is never checked per cell or scanned for data. Placing a symbiont in a
+    * cell brings the layer back.
+    *
+  */
+  bool free_living_layer = true;
 
   /**
     *
@@ -44,6 +73,14 @@ protected:
   */
   emp::Ptr<SymConfigBase> my_config = NULL;
 
+  /**
+    *
+    * Purpose: Represents the settings read for every organism in every
+    * update, frozen by FreezeConfig() (see ConfigSnapshot.h).
+    *
+  */
+  ConfigSnapshot config_snapshot;
+
   /**
     *
     * Purpose: Represents the systematics object tracking hosts.
@@ -74,6 +111,176 @@ protected:
   emp::Ptr<emp::DataMonitor<int>> data_node_successes_horiztrans;
   emp::Ptr<emp::DataMonitor<int>> data_node_attempts_verttrans;
 
+  /**
+    *
+    * Purpose: Represents the file memory reports are written to, when
+    * MEMORY_REPORT is on (see OpenMemoryReportFile).
+    *
+  */
+  std::ofstream memory_report_file;
+
+  /**
+    *
+    * Purpose: Represents how a data monitor is recomputed from the
+    * population: reset clears it, and add gives it the datum taken from each
+    * host, each hosted symbiont (with its host) and each free-living
+    * symbiont by host, hosted_sym and free_sym. Any of these can be left
+    * empty; a monitor of a count the world keeps only needs reset. The
+    * functions that take the data only read the organisms, so they can be
+    * called from several threads at once. node is the monitor fed, and
+    * standard_error the standard error of its mean when it is fed from a
+    * sample of the cells (see STATS_SAMPLE).
+    *
+  */
+  struct StatsCollector {
+    std::function<void()> reset;
+    std::function<void(double val)> add;
+    std::function<double(emp::Ptr<Organism> host)> host;
+    std::function<double(emp::Ptr<Organism> host, emp::Ptr<Organism> sym)> hosted_sym;
+    std::function<double(emp::Ptr<Organism> sym)> free_sym;
+    const void * node = nullptr;
+    double standard_error = 0;
+  };
+
+  /**
+    *
+    * Purpose: Represents the data monitors' collectors, fed by a single pass
+    * over the population (see CollectStats), and which of them take data
+    * from hosts, hosted symbionts and free-living symbionts.
+    *
+  */
+  emp::vector<StatsCollector> stats_collectors;
+  emp::vector<size_t> stats_host_ids;
+  emp::vector<size_t> stats_hosted_sym_ids;
+  emp::vector<size_t> stats_free_sym_ids;
+
+  /**
+    *
+    * Purpose: Represents the number of cells each thread takes data from in
+    * a round of a threaded pass, and the data each thread has taken in the
+    * current round, by collector (see CollectStatsInParallel).
+    *
+  */
+  static constexpr size_t STATS_SLICE = 1 << 16;
+  emp::vector<emp::vector<emp::vector<double>>> stats_buffers;
+
+  /**
+    *
+    * Purpose: Represents whether the data monitors are only recomputed when
+    * a file that prints them is about to (see SetupStatsFile), and the
+    * update they were last recomputed for in that case.
+    *
+  */
+  bool stats_on_print = false;
+  size_t stats_update = (size_t) -1;
+
+  /**
+    *
+    * Purpose: Represents the random number generator the cells sampled for
+    * the statistics are drawn with (see CollectSampledStats), kept apart
+    * from the world's so that sampling does not change the run, and how many
+    * cells of the world each sampled cell stands for.
+    *
+  */
+  emp::Random stats_random;
+  double stats_sample_scale = 1;
+
+  /**
+    *
+    * Purpose: Represents counts of the population that are kept up to date
+    * as hosts are placed and removed and as their symbionts change (see
+    * CountHost), so that they can be read without a scan: the hosts, the
+    * symbionts in hosts, the hosts with symbionts and the hosts with a
+    * lytic phage. Hosts on different threads can change at once, so the
+    * counts are atomic.
+    *
+  */
+  std::atomic<long> num_hosts{0};
+  std::atomic<long> num_hosted_syms{0};
+  std::atomic<long> num_infected_hosts{0};
+  std::atomic<long> num_lytic_hosts{0};
+
+  /**
+    *
+    * Purpose: Represent the kinds of counter-based random streams (see GetStreamSeed).
+    *
+  */
+  enum RandomStream { CELL_STREAM = 0, TILE_STREAM = 1, SCHEDULE_STREAM = 2 };
+
+  /**
+    *
+    * Purpose: Represents the random stream that the calling thread should draw
+    * from while it processes a tile or (with COUNTER_RNG) a cell. Null otherwise,
+    * in which case organisms draw from their own generator.
+    *
+  */
+  static inline thread_local emp::Ptr<emp::Random> thread_random = nullptr;
+
+  /**
+    *
+    * Purpose: Represents the generator that is reseeded for the update schedule
+    * and for each cell of a non-tiled update when COUNTER_RNG is on.
+    *
+  */
+  emp::Ptr<emp::Random> stream_random = nullptr;
+
+  /**
+    *
+    * Purpose: Represents whether Update() is currently processing tiles,
+    * in which case changes to shared state are serialised.
+    *
+  */
+  bool threaded_update = false;
+
+  /**
+    *
+    * Purpose: Guards the state shared between tiles during a threaded update:
+    * the organism count, the resource pool, and the event data monitors.
+    *
+  */
+  std::mutex shared_state_mutex;
+
+  /**
+    *
+    * Purpose: Represents the tiles of a threaded update, and the worker
+    * threads that process them for the life of the world.
+    *
+  */
+  TiledUpdate tiles;
+
+  /**
+    *
+    * Purpose: Represents the order in which cells are visited during an update.
+    * It is kept between updates and refilled in place, so that building the
+    * schedule does not allocate once the world has reached its size.
+    *
+  */
+  emp::vector<size_t> schedule;
+
+  /**
+    *
+    * Purpose: Represents the changes that a synchronous update (SYNCHRONOUS 1)
+    * holds back until every cell has been processed.
+    *
+  */
+  SynchronousUpdate pending;
+
+  /**
+    *
+    * Purpose: Represents the event queue of event-driven updates (EVENT_DRIVEN 1).
+    *
+  */
+  EventDrivenUpdate events;
+
+  /**
+    *
+    * Purpose: Represents the cells holding a host and/or a free-living
+    * symbiont. Kept up to date by AddOrgAt, DoDeath, DoSymDeath and ExtractSym.
+    *
+  */
+  ActiveCells active_cells;
+  static constexpr size_t NOT_ACTIVE = ActiveCells::NOT_ACTIVE;
+
 
 public:
   /**
@@ -89,6 +296,8 @@ public:
       os << "This doesn't work currently";
     };
     my_config = _config;
+    config_snapshot = ConfigSnapshot::Freeze(*my_config);
+    stats_random.ResetSeed(my_config->SEED());
     total_res = my_config->LIMITED_RES_TOTAL();
     if (my_config->PHYLOGENY() == true){
       host_sys = emp::NewPtr<emp::Systematics<Organism, int>>(GetCalcInfoFun());
@@ -100,6 +309,17 @@ public:
       sym_sys-> AddSnapshotFun( [](const emp::Taxon<int> & t){return std::to_string(t.GetInfo());}, "info");
       host_sys->AddSnapshotFun( [](const emp::Taxon<int> & t){return std::to_string(t.GetInfo());}, "info");
     }
+
+    OnPlacement([this](size_t pos){
+      pop[pos]->SetInWorld(true);
+      num_hosts++;
+      CountHost(pop[pos], 1);
+    });
+    OnOrgDeath([this](size_t pos){
+      CountHost(pop[pos], -1);
+      num_hosts--;
+      pop[pos]->SetInWorld(false);
+    });
   }
 
 
@@ -126,16 +346,16 @@ public:
     if (data_node_attempts_horiztrans) data_node_attempts_horiztrans.Delete();
     if (data_node_attempts_horiztrans) data_node_successes_horiztrans.Delete();
     if (data_node_attempts_verttrans) data_node_attempts_verttrans.Delete();
+    if (stream_random) stream_random.Delete();
 
-    for(size_t i = 0; i < sym_pop.size(); i++){ //host population deletion is handled by empirical world destructor
-      if(sym_pop[i]) {
-        DoSymDeath(i);
-      }
+    for(size_t i : sym_pop.GetOccupiedCells()){ //host population deletion is handled by empirical world destructor
+      DoSymDeath(i);
     }
 
+    // delete hosts here so that hosted symbionts get deleted and unlinked
+    // from the sym_sys, while the population counts they update still exist
+    Clear();
     if(my_config->PHYLOGENY()){ //host systematic deletion is handled by empirical world destructor
-      Clear(); // delete hosts here so that hosted symbionts get 
-      // deleted and unlinked from the sym_sys
       sym_sys.Delete();
     }
   }
@@ -159,7 +379,157 @@ public:
    *
    * Purpose: To get the world's symbiont population.
    */
-  emp::World<Organism>::pop_t GetSymPop() {return sym_pop;}
+  emp::World<Organism>::pop_t GetSymPop() {
+    pop_t syms(sym_pop.size());
+    for (size_t i : sym_pop.GetOccupiedCells()) syms[i] = sym_pop[i];
+    return syms;
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: Whether the world has a free-living layer (sym_pop).
+   *
+   * Purpose: To check whether free-living symbionts are kept.
+   */
+  bool HasFreeLivingLayer() const {return free_living_layer;}
+
+
+  /**
+   * Input: None
+   *
+   * Output: The world's free-living symbionts.
+   *
+   * Purpose: To get the free-living layer, e.g. to check which form it is in.
+   */
+  const FreeSymLayer & GetFreeSymLayer() const {return sym_pop;}
+
+
+  /**
+   * Input: Whether the world should have a free-living layer.
+   *
+   * Output: None
+   *
+   * Purpose: To add or drop the free-living layer. The layer is only
+   * dropped if it holds no symbionts.
+   */
+  void SetFreeLivingLayer(bool _in) {
+    if (_in && !free_living_layer) {
+      free_living_layer = true;
+      sym_pop.resize(pop.size());
+    } else if (!_in && free_living_layer) {
+      if (sym_pop.GetCount() > 0) return;
+      free_living_layer = false;
+      sym_pop = FreeSymLayer();
+    }
+  }
+
+
+  /**
+   * Input: The size_t location of a cell.
+   *
+   * Output: Whether there is a free-living symbiont in the cell.
+   *
+   * Purpose: To check a cell for a free-living symbiont without reading
+   * sym_pop when the world has no free-living layer.
+   */
+  bool HasFreeSymAt(size_t i) const {return free_living_layer && i < sym_pop.size() && sym_pop.Has(i);}
+
+
+  /**
+   * Input: A host in the world, and 1 to add it to the population counts
+   * or -1 to take it out of them.
+   *
+   * Output: None
+   *
+   * Purpose: To keep the population counts up to date. A change to the
+   * symbionts of a host in the world is counted by taking the host out of
+   * the counts just before the change and adding it back just after.
+   */
+  void CountHost(emp::Ptr<Organism> host, int sign) {
+    SymbiontList & syms = host->GetSymbionts();
+    if (syms.empty()) return;
+    bool lytic = false;
+    for (emp::Ptr<Organism> sym : syms) {
+      if (sym->IsPhage() && !sym->GetLysogeny()) {
+        lytic = true;
+        break;
+      }
+    }
+    num_hosted_syms += sign * (long) syms.size();
+    num_infected_hosts += sign;
+    if (lytic) num_lytic_hosts += sign;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The number of hosts, of symbionts in hosts, of free-living
+   * symbionts, of hosts with symbionts, and of hosts with a lytic phage.
+   *
+   * Purpose: To read the population counts without a scan.
+   */
+  size_t GetNumHosts() const {return num_hosts;}
+  size_t GetNumHostedSyms() const {return num_hosted_syms;}
+  size_t GetNumFreeSyms() const {return free_living_layer ? sym_pop.GetCount() : 0;}
+  size_t GetNumInfectedHosts() const {return num_infected_hosts;}
+  size_t GetNumLyticHosts() const {return num_lytic_hosts;}
+
+
+  /**
+   * Input: The generator to fall back on
+   *
+   * Output: The random stream of the tile the calling thread is processing,
+   * or the fallback generator outside of a threaded update.
+   *
+   * Purpose: To let organisms draw random numbers without racing on a
+   * shared generator during threaded updates.
+   */
+  static emp::Random & GetThreadRandom(emp::Ptr<emp::Random> fallback) {
+    if (thread_random) return *thread_random;
+    return *fallback;
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The random number generator the world should currently draw from.
+   *
+   * Purpose: To hide the Empirical GetRandom so that world-level draws made
+   * while processing a tile use that tile's stream.
+   */
+  emp::Random & GetRandom() { return GetThreadRandom(random_ptr); }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The generator used for counter-based streams outside of tiles.
+   *
+   * Purpose: To lazily create the generator that is reseeded for the update
+   * schedule and for each cell when COUNTER_RNG is on.
+   */
+  emp::Random & GetStreamRandom() {
+    if (!stream_random) stream_random = emp::NewPtr<emp::Random>(1);
+    return *stream_random;
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: A lock on the world's shared state, which is only held
+   * during threaded updates.
+   *
+   * Purpose: To serialise changes to state shared between tiles (organism counts,
+   * resources, event data monitors) while several threads are processing tiles.
+   */
+  std::unique_lock<std::mutex> LockSharedState() {
+    if (threaded_update) return std::unique_lock<std::mutex>(shared_state_mutex);
+    return std::unique_lock<std::mutex>(shared_state_mutex, std::defer_lock);
+  }
 
 
   /**
@@ -253,6 +623,7 @@ public:
     if(total_res == -1) { //if LIMITED_RES_TOTAL == -1, unlimited
       return desired_resources;
     } else {
+      std::unique_lock<std::mutex> lock = LockSharedState();
       if (total_res>=desired_resources) {
         total_res = total_res - desired_resources;
         return desired_resources;
@@ -266,6 +637,24 @@ public:
     }
   }
 
+  /**
+   * Input: None
+   *
+   * Output: Whether organisms draw from a limited pool of resources (LIMITED_RES_TOTAL).
+   *
+   * Purpose: To check whether resources are limited.
+   */
+  bool HasLimitedResources() {return total_res != -1;}
+
+  /**
+   * Input: None
+   *
+   * Output: The world's configuration.
+   *
+   * Purpose: To get the configuration the world was built with.
+   */
+  emp::Ptr<SymConfigBase> GetConfig() {return my_config;}
+
 
   /**
    * Input: The size_t representing the world's new width;
@@ -289,12 +678,42 @@ public:
    *
    * Purpose: To override the Empirical Resize function with
    * a single-arg method that can be used for AddOrgAt vector
-   * expansions
+   * expansions. Only the cells cut off or added are checked against the
+   * list of active cells, so growing the world a cell at a time stays cheap.
    */
   void Resize(size_t new_size){
+    size_t old_size = active_cells.GetNumCells();
+    MemoryPolicy::Reserve(pop, new_size);
     pop.resize(new_size);
-    sym_pop.resize(new_size);
+    if (free_living_layer) sym_pop.resize(new_size);
     pop_sizes.resize(2);
+
+    for (size_t i = new_size; i < old_size; i++) UpdateActiveCell(i);
+    active_cells.Resize(new_size);
+    for (size_t i = old_size; i < new_size; i++) UpdateActiveCell(i);
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The list of cells holding a host and/or a free-living symbiont, in no particular order.
+   *
+   * Purpose: To get the world's active cells.
+   */
+  const emp::vector<size_t> & GetActiveCells() {return active_cells.GetCells();}
+
+
+  /**
+   * Input: The size_t location of a cell that may have gained or lost organisms.
+   *
+   * Output: None
+   *
+   * Purpose: To add the cell to, or remove it from, the list of active cells.
+   */
+  void UpdateActiveCell(size_t i) {
+    if (i >= active_cells.GetNumCells()) active_cells.Resize(std::max(pop.size(), sym_pop.size()));
+    active_cells.Set(i, (i < pop.size() && pop[i]) || HasFreeSymAt(i));
   }
 
 
@@ -316,25 +735,30 @@ public:
     //HOSTS have position in the overall world as their index
 
     //if the pos it out of bounds, expand the worlds so that they can fit it.
-    if(pos.GetPopID() >= sym_pop.size() || pos.GetIndex() >= pop.size()){
+    if(pos.GetPopID() >= pop.size() || pos.GetIndex() >= pop.size()){
       if(pos.GetPopID() > pos.GetIndex()) Resize(pos.GetPopID() + 1);
       else Resize(pos.GetIndex() + 1);
     }
+    if(!new_org->IsHost()) SetFreeLivingLayer(true);
 
+    WakeCell(new_org->IsHost() ? pos.GetIndex() : pos.GetPopID());
+    std::unique_lock<std::mutex> lock = LockSharedState();
     if(new_org->IsHost()){ //if the org is a host, use the empirical addorgat function
       emp::World<Organism>::AddOrgAt(new_org, pos, p_pos);
+      UpdateActiveCell(pos.GetIndex());
 
     } else { //if it is not a host, then add it to the sym population
       //for symbionts, their place in their host's world is indicated by their ID
       size_t pos_id = pos.GetPopID();
-      if(!sym_pop[pos_id]) {
+      if(!sym_pop.Has(pos_id)) {
         ++num_orgs;
       } else {
         sym_pop[pos_id].Delete();
       }
 
       //set the cell to point to the new sym
-      sym_pop[pos_id] = new_org;
+      sym_pop.Set(pos_id, new_org);
+      UpdateActiveCell(pos_id);
     }
   }
 
@@ -356,7 +780,12 @@ public:
 
     offspring_ready_sig.Trigger(*new_org, parent_pos);
     pos = fun_find_birth_pos(new_org, parent_pos);
-    if (pos.IsValid() && (pos.GetIndex() != parent_pos)) {
+    if (pos.IsValid() && (pos.GetIndex() != parent_pos) && my_config->SYNCHRONOUS()) {
+      //Hold the offspring back until the end of the update
+      std::unique_lock<std::mutex> lock = LockSharedState();
+      pending.HoldHost(new_org, parent_pos, pos);
+    }
+    else if (pos.IsValid() && (pos.GetIndex() != parent_pos)) {
       //Add to the specified position, overwriting what may exist there
       AddOrgAt(new_org, pos, parent_pos);
     }
@@ -367,6 +796,21 @@ public:
   }
 
 
+  /**
+   * Input: The WorldPosition of the host to be removed.
+   *
+   * Output: None
+   *
+   * Purpose: To overwrite the Empirical DoDeath so that host deaths
+   * are serialised during threaded updates.
+   */
+  void DoDeath(const emp::WorldPosition pos) {
+    std::unique_lock<std::mutex> lock = LockSharedState();
+    emp::World<Organism>::DoDeath(pos);
+    UpdateActiveCell(pos.GetIndex());
+  }
+
+
   /**
    * Input: The size_t value representing the location whose neighbors
    * are being searched.
@@ -386,7 +830,7 @@ public:
     }
 
     // Then enumerate all occupied neighbors, in case many neighbors are unoccupied
-    const emp::vector<size_t> validNeighbors = GetValidNeighborOrgIDs(id);
+    const emp::vector<size_t> validNeighbors = threaded_update ? GetOccupiedGridNeighborIDs(id) : GetValidNeighborOrgIDs(id);
     if (validNeighbors.empty()) return -1;
     else {
       int randI = GetRandom().GetUInt(0, validNeighbors.size());
@@ -395,6 +839,35 @@ public:
   }
 
 
+  /**
+   * Input: The size_t value representing the location whose neighbors
+   * are being searched.
+   *
+   * Output: The sorted locations of the occupied cells in the grid
+   * neighborhood (including the location itself).
+   *
+   * Purpose: To find occupied grid neighbors by only looking at the
+   * surrounding cells, rather than scanning the whole population.
+   */
+  emp::vector<size_t> GetOccupiedGridNeighborIDs(size_t id) {
+    emp::vector<size_t> valid_ids;
+    const int width = GetWidth();
+    const int height = GetHeight();
+    const int x = id % width;
+    const int y = id / width;
+    for (int offset = 0; offset < 9; offset++) {
+      const int neighbor_x = (x + offset % 3 - 1 + width) % width;
+      const int neighbor_y = (y + offset / 3 - 1 + height) % height;
+      const size_t neighbor_id = neighbor_x + neighbor_y * width;
+      if (IsOccupied(neighbor_id) && std::find(valid_ids.begin(), valid_ids.end(), neighbor_id) == valid_ids.end()) {
+        valid_ids.push_back(neighbor_id);
+      }
+    }
+    std::sort(valid_ids.begin(), valid_ids.end());
+    return valid_ids;
+  }
+
+
   /**
      * Input: The pointer to a host that will be added to the world. This function assumes that the
      * pop vector has not been resized to fit the world yet.
@@ -432,7 +905,7 @@ public:
     } else {
       new_loc = GetRandomCellID();
       //if the position is within bounds, add the sym to it
-      if(new_loc < sym_pop.size()) {
+      if(new_loc < pop.size()) {
         AddOrgAt(new_sym, emp::WorldPosition(0, new_loc));
       } else new_sym.Delete();
     }
@@ -448,6 +921,7 @@ public:
   emp::Ptr<emp::Taxon<int>> GetDominantSymTaxon();
   emp::Ptr<emp::Taxon<int>> GetDominantHostTaxon();
   emp::vector<emp::Ptr<emp::Taxon<int>>> GetDominantFreeHostedSymTaxon();
+  emp::DataFile & SetupStatsFile(const std::string & filename);
   emp::DataFile & SetupSymIntValFile(const std::string & filename);
   emp::DataFile & SetupHostIntValFile(const std::string & filename);
   emp::DataFile & SetUpFreeLivingSymFile(const std::string & filename);
@@ -468,6 +942,96 @@ public:
   emp::DataMonitor<double,emp::data::Histogram>& GetSymInfectChanceDataNode();
   emp::DataMonitor<double,emp::data::Histogram>& GetFreeSymInfectChanceDataNode();
   emp::DataMonitor<double,emp::data::Histogram>& GetHostedSymInfectChanceDataNode();
+  void AddStatsCollector(const StatsCollector & collector);
+  template <typename SINK>
+  void VisitStats(size_t begin, size_t end, SINK & sink);
+  virtual void CollectStats();
+  void CollectStatsInParallel(size_t num_threads);
+  void CollectSampledStats(size_t sample_size);
+  double GetStatsStandardError(const void * node);
+  bool CountsMatchPopulation();
+  MemoryReport GetMemoryReport();
+  virtual void AddDataMonitorsTo(MemoryReport & report);
+  void OpenMemoryReportFile(const std::string & filename);
+  void WriteMemoryReport();
+
+  /**
+   * Input: A data monitor, and the functions that take its datum from each
+   * host, each hosted symbiont (with its host) and each free-living
+   * symbiont. Any of them can be nullptr.
+   *
+   * Output: None
+   *
+   * Purpose: To have a data monitor recomputed from the population.
+   */
+  template <typename NODE>
+  void AddStatsCollector(emp::Ptr<NODE> node,
+                         std::function<double(emp::Ptr<Organism>)> host,
+                         std::function<double(emp::Ptr<Organism>, emp::Ptr<Organism>)> hosted_sym = nullptr,
+                         std::function<double(emp::Ptr<Organism>)> free_sym = nullptr) {
+    AddStatsCollector({[node](){node->Reset();}, [node](double val){node->AddDatum(val);},
+                       host, hosted_sym, free_sym, node.Raw()});
+  }
+
+  /**
+   * Input: The file to add to, a data monitor recomputed from the
+   * population, and the column's key and description. The mean may be reset
+   * after it is printed, as with DataFile::AddMean.
+   *
+   * Output: None
+   *
+   * Purpose: To add the mean of a monitor to a file. When the statistics
+   * are taken from a sample of the cells (STATS_SAMPLE), the mean's standard
+   * error is added in a column after it, keyed key_se.
+   */
+  template <typename NODE>
+  void AddStatsMean(emp::DataFile & file, NODE & node, const std::string & key,
+                    const std::string & desc, bool reset = false) {
+    file.AddMean(node, key, desc, reset);
+    if (my_config->STATS_SAMPLE() > 0) {
+      file.AddFun<double>([this, &node](){return GetStatsStandardError(&node);},
+                          key + "_se", "Standard error of: " + desc);
+    }
+  }
+
+  /**
+   * Input: The file to add to, a histogram monitor recomputed from the
+   * population, the bin, and the column's key and description.
+   *
+   * Output: None
+   *
+   * Purpose: To add a histogram bin of a monitor to a file. When the
+   * statistics are taken from a sample of the cells (STATS_SAMPLE), the
+   * sample's count is scaled up to an estimate for the whole world.
+   */
+  template <typename NODE>
+  void AddStatsHistBin(emp::DataFile & file, NODE & node, size_t bin,
+                       const std::string & key, const std::string & desc) {
+    if (my_config->STATS_SAMPLE() > 0) {
+      file.AddFun<double>([this, &node, bin](){return node.GetHistCounts()[bin] * stats_sample_scale;},
+                          key, desc);
+    } else {
+      file.AddHistBin(node, bin, key, desc);
+    }
+  }
+
+  /**
+   * Input: The report to add to, and a data monitor (or nullptr, if it
+   * hasn't been made).
+   *
+   * Output: None
+   *
+   * Purpose: To account for a data monitor. Histogram monitors also hold
+   * their bin counts, which AddHistogramMonitorTo accounts for as well.
+   */
+  template <typename NODE>
+  static void AddMonitorTo(MemoryReport & report, emp::Ptr<NODE> node) {
+    if (node) report.Add("data_monitors", 1, sizeof(NODE));
+  }
+  template <typename NODE>
+  static void AddHistogramMonitorTo(MemoryReport & report, emp::Ptr<NODE> node) {
+    if (node) report.Add("data_monitors", 1, sizeof(NODE) + node->GetHistCounts().capacity() * sizeof(size_t));
+  }
 
   /**
    * Definitions of setup functions, expanded in WorldSetup.cc
@@ -489,7 +1053,12 @@ public:
     size_t i = parent_pos.GetPopID();
     emp::WorldPosition indexed_id = GetRandomNeighborPos(i);
     emp::WorldPosition new_pos = emp::WorldPosition(0, indexed_id.GetIndex());
-    if(IsInboundsPos(new_pos)){
+    if(IsInboundsPos(new_pos) && my_config->SYNCHRONOUS()){
+      sym->SetHost(nullptr);
+      std::unique_lock<std::mutex> lock = LockSharedState();
+      pending.HoldSym(sym, i, new_pos.GetPopID(), false);
+      return new_pos;
+    } else if(IsInboundsPos(new_pos)){
       sym->SetHost(nullptr);
       AddOrgAt(sym, new_pos, parent_pos);
       return new_pos;
@@ -513,7 +1082,7 @@ public:
       return false;
     } else if (pos.GetIndex() >= pop.size()){
       return false;
-    } else if (pos.GetPopID() >= sym_pop.size()){
+    } else if (pos.GetPopID() >= pop.size()){
       return false;
     }
     return true;
@@ -536,7 +1105,13 @@ public:
     size_t i = parent_pos.GetPopID();
     if(my_config->FREE_LIVING_SYMS() == 0){
       int new_host_pos = GetNeighborHost(i);
-      if (new_host_pos > -1) { //-1 means no living neighbors
+      if (new_host_pos > -1 && my_config->SYNCHRONOUS()) {
+        //infection is attempted (and counted if it succeeds) at the end of the update
+        std::unique_lock<std::mutex> lock = LockSharedState();
+        pending.HoldSym(sym_baby, i, (size_t) new_host_pos, true);
+        return emp::WorldPosition();
+      } else if (new_host_pos > -1) { //-1 means no living neighbors
+        WakeCell(new_host_pos);
         int new_index = pop[new_host_pos]->AddSymbiont(sym_baby);
         if(new_index > 0){ //sym successfully infected
           return emp::WorldPosition(new_index, new_host_pos);
@@ -563,7 +1138,7 @@ public:
   void MoveFreeSym(emp::WorldPosition pos){
     size_t i = pos.GetPopID();
     //the sym can either move into a parallel sym or to some random position
-    if(IsOccupied(i) && sym_pop[i]->WantsToInfect()) {
+    if(IsOccupied(i) && !pop[i]->GetDead() && sym_pop[i]->WantsToInfect()) {
       emp::Ptr<Organism> sym = ExtractSym(i);
       if(sym->InfectionFails()) sym.Delete(); //if the sym tries to infect and fails it dies
       else pop[i]->AddSymbiont(sym);
@@ -583,6 +1158,8 @@ public:
   emp::Ptr<Organism> GetSymAt(size_t location){
     if (location >= 0 && location < sym_pop.size()){
       return sym_pop[location];
+    } else if (location < pop.size()) { //no free-living layer
+      return nullptr;
     } else {
       throw "Attempted to get out of bounds sym.";
     }
@@ -598,11 +1175,13 @@ public:
    */
   emp::Ptr<Organism> ExtractSym(size_t i){
     emp::Ptr<Organism> sym;
-    if(sym_pop[i]){
+    std::unique_lock<std::mutex> lock = LockSharedState();
+    if(HasFreeSymAt(i)){
       sym = sym_pop[i];
       num_orgs--;
-      sym_pop[i] = nullptr;
+      sym_pop.Set(i, nullptr);
     }
+    UpdateActiveCell(i);
     return sym;
   }
 
@@ -615,11 +1194,13 @@ public:
    * Purpose: To delete a symbiont from the world.
    */
   void DoSymDeath(size_t i){
-    if(sym_pop[i]){
+    std::unique_lock<std::mutex> lock = LockSharedState();
+    if(HasFreeSymAt(i)){
       sym_pop[i].Delete();
-      sym_pop[i] = nullptr;
+      sym_pop.Set(i, nullptr);
       num_orgs--;
     }
+    UpdateActiveCell(i);
   }
 
   /**
@@ -641,14 +1222,37 @@ public:
         }
       }
     }
+    FreezeConfig();
   }
 
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To take a new snapshot of the settings read every update. This
+   * is done by Setup() and whenever the world changes its own settings.
+   * Worlds that pick their update kernels by the snapshot (see SymWorldT)
+   * override this to pick them again.
+   */
+  virtual void FreezeConfig() {config_snapshot = ConfigSnapshot::Freeze(*my_config);}
+
+  /**
+   * Input: None
+   *
+   * Output: The snapshot of the settings read every update.
+   *
+   * Purpose: To get the snapshot taken by the last FreezeConfig().
+   */
+  const ConfigSnapshot & GetConfigSnapshot() const {return config_snapshot;}
+
   /**
    * Input: Optional boolean "verbose" that specifies whether to print the update numbers to standard output or not, defaults to true.
    *
    * Output: None
    *
    * Purpose: Run the number of updates and non-mutation updates specified in the configuration settings.
+   * With event-driven updates, every cell is brought up to date at the end.
    */
   void RunExperiment(bool verbose=true) {
     //Loop through updates
@@ -665,8 +1269,22 @@ public:
     if(num_no_mut_updates > 0) {
       SetMutationZero();
     }
+    RunNoMutUpdates(num_no_mut_updates, verbose);
 
-    for (int i = 0; i < num_no_mut_updates; i++) {
+    CatchUpAllCells();
+    if (memory_report_file.is_open()) WriteMemoryReport();
+  }
+
+  /**
+   * Input: The number of no-mutation updates, and whether progress should be printed.
+   *
+   * Output: None
+   *
+   * Purpose: To run the no-mutation updates. Worlds that can run them some
+   * other way (see GenotypeCountWorld) override this.
+   */
+  virtual void RunNoMutUpdates(int num_updates, bool verbose) {
+    for (int i = 0; i < num_updates; i++) {
       if(verbose && (i%my_config->DATA_INT())==0) {
         std::cout <<"No mutation update: "<< i << std::endl;
         std::cout.flush();
@@ -676,6 +1294,285 @@ public:
   }
 
 
+  /**
+   * Input: The 64-bit key to be mixed.
+   *
+   * Output: The mixed key.
+   *
+   * Purpose: To scramble the bits of a stream key (the SplitMix64 finalizer),
+   * so that neighboring keys give unrelated seeds.
+   */
+  static uint64_t MixStreamKey(uint64_t key) {
+    key += 0x9e3779b97f4a7c15;
+    key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9;
+    key = (key ^ (key >> 27)) * 0x94d049bb133111eb;
+    return key ^ (key >> 31);
+  }
+
+  /**
+   * Input: The kind of stream (a RandomStream) and the id of the cell or tile it belongs to.
+   *
+   * Output: A positive seed for the stream.
+   *
+   * Purpose: To key counter-based random streams by (seed, update, stream, id).
+   * A stream's n-th draw is then fixed by those values and n alone, no matter
+   * which thread processes the cell or in which order cells are processed.
+   */
+  int GetStreamSeed(size_t stream, size_t id) {
+    uint64_t key = MixStreamKey((uint64_t) random_ptr->GetSeed());
+    key = MixStreamKey(key ^ (uint64_t) GetUpdate());
+    key = MixStreamKey(key ^ ((uint64_t) stream << 56) ^ (uint64_t) id);
+    return (int) (key % 2147483646) + 1;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: Whether this update should be processed in checkerboard tiles.
+   *
+   * Purpose: To check that tiles are wanted (THREADS above 1, or COUNTER_RNG
+   * so that a single thread follows the same schedule as several), that the
+   * world is a grid, and that nothing shared between cells (e.g. phylogenies)
+   * would be touched from several threads.
+   */
+  bool CanUpdateInParallel() {
+    return (my_config->THREADS() > 1 || my_config->COUNTER_RNG()) && my_config->GRID() && !my_config->PHYLOGENY()
+      && pop_sizes.size() == 2 && GetWidth() * GetHeight() == GetSize();
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To split the grid into tiles for threaded updates and bind the
+   * neighbor functions to the world's GetRandom, so that they draw from the
+   * calling thread's stream. This is done when the world is set up, and again
+   * only if the grid has changed shape since.
+   */
+  void SetupTiles() {
+    tiles.Setup(GetWidth(), GetHeight(), my_config->SYNCHRONOUS());
+
+    fun_get_neighbor = [this](emp::WorldPosition pos) {
+      const int width = GetWidth();
+      const int height = GetHeight();
+      const int offset = GetRandom().GetInt(9);
+      const int neighbor_x = ((int) (pos.GetIndex() % width) + offset % 3 - 1 + width) % width;
+      const int neighbor_y = ((int) (pos.GetIndex() / width) + offset / 3 - 1 + height) % height;
+      return pos.SetIndex(neighbor_x + neighbor_y * width);
+    };
+    fun_find_birth_pos = [this](emp::Ptr<Organism> new_org, emp::WorldPosition parent_pos) {
+      return fun_get_neighbor(parent_pos);
+    };
+  }
+
+  /**
+   * Input: The size_t representing the cell to be processed.
+   *
+   * Output: None
+   *
+   * Purpose: To process the host and the free-living symbiont in a cell.
+   * Worlds that know the exact types of their organisms (see SymWorldT)
+   * override this to process them without going through their vtables.
+   */
+  virtual void ProcessCell(size_t i) {ProcessCellAs<Organism, Organism>(*this, i, LiveParams(*my_config));}
+
+  /**
+   * Input: The size_t location of a host that died.
+   *
+   * Output: None
+   *
+   * Purpose: To leave a dead host in its cell until the end of a synchronous update.
+   */
+  void HoldDeath(size_t i) {
+    std::unique_lock<std::mutex> lock = LockSharedState();
+    pending.HoldDeath(i);
+  }
+
+  /**
+   * Input: The size_t id of the tile to be processed.
+   *
+   * Output: None
+   *
+   * Purpose: To process every cell in a tile in a random order, drawing
+   * from the tile's own random stream (reseeded for each cell with COUNTER_RNG).
+   */
+  void ProcessTile(size_t tile) {
+    thread_random = tiles.GetTileRandom(tile);
+    emp::vector<size_t> & tile_schedule = tiles.GetTileCells(tile);
+    emp::Shuffle(*thread_random, tile_schedule);
+    for (size_t i : tile_schedule) {
+      if (my_config->COUNTER_RNG()) thread_random->ResetSeed(GetStreamSeed(CELL_STREAM, i));
+      ProcessCell(i);
+    }
+    thread_random = nullptr;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To process every cell of a grid world on THREADS threads. The tiles
+   * are processed one colour at a time; tiles of the same colour are at least
+   * two cells apart, and everything a cell does (births, infection, movement)
+   * stays within one cell of it, so tiles of one colour never touch the same cells.
+   * In synchronous updates all tiles share one colour.
+   * Tile streams are seeded from the world's generator (or keyed by tile with
+   * COUNTER_RNG), so the results for a seed do not depend on the number of threads
+   * (unless resources are limited, since the order in which tiles pull from the
+   * shared pool then matters).
+   */
+  void UpdateTiles() {
+    if (!tiles.IsSetUp(GetWidth(), GetHeight(), my_config->SYNCHRONOUS())) SetupTiles();
+    size_t num_tiles = tiles.GetNumTiles();
+    if (my_config->COUNTER_RNG()) {
+      GetStreamRandom().ResetSeed(GetStreamSeed(SCHEDULE_STREAM, 0));
+      tiles.ShuffleColours(GetStreamRandom());
+      for (size_t tile = 0; tile < num_tiles; tile++) {
+        tiles.GetTileRandom(tile)->ResetSeed(GetStreamSeed(TILE_STREAM, tile));
+      }
+    } else {
+      tiles.ShuffleColours(GetRandom());
+      for (size_t tile = 0; tile < num_tiles; tile++) {
+        tiles.GetTileRandom(tile)->ResetSeed(GetRandom().GetUInt(1, 2147483647));
+      }
+    }
+
+    threaded_update = true;
+    tiles.Run(my_config->THREADS(), [this](size_t tile) { ProcessTile(tile); });
+    threaded_update = false;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The number of worker threads kept for threaded updates.
+   *
+   * Purpose: To check that the threads of threaded updates are reused.
+   */
+  size_t GetNumTileWorkers() const {return tiles.GetNumWorkers();}
+
+  /**
+   * Input: None
+   *
+   * Output: The random number generator that orders the changes held back
+   * by a synchronous update.
+   *
+   * Purpose: To order the held-back changes from the world's generator, or
+   * (with COUNTER_RNG) from a stream keyed by the update.
+   */
+  emp::Random & GetPendingOrderRandom() {
+    if (my_config->COUNTER_RNG()) {
+      GetStreamRandom().ResetSeed(GetStreamSeed(SCHEDULE_STREAM, 1));
+      return GetStreamRandom();
+    }
+    return GetRandom();
+  }
+
+  /**
+   * Input: The random number generator to use, the vector to fill, and the
+   * size of the permutation.
+   *
+   * Output: None
+   *
+   * Purpose: To fill an existing vector with a random permutation of 0 to size-1,
+   * reusing its storage. It makes the same draws as emp::GetPermutation (an
+   * inside-out Fisher-Yates shuffle), so schedules match those of earlier versions.
+   */
+  static void FillPermutation(emp::Random & random, emp::vector<size_t> & permutation, size_t size) {
+    permutation.resize(size);
+    if (size == 0) return;
+    permutation[0] = 0;
+    for (size_t i = 1; i < size; i++) {
+      size_t val_pos = random.GetUInt(i+1);
+      permutation[i] = permutation[val_pos];
+      permutation[val_pos] = i;
+    }
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The order in which cells were visited during the last (non-tiled) update.
+   *
+   * Purpose: To get the world's schedule buffer.
+   */
+  const emp::vector<size_t> & GetSchedule() {return schedule;}
+
+  /**
+   * Input: None
+   *
+   * Output: The organism pool's stats: live organisms, allocations and how
+   * many reused a dead organism's slot, and slab slots and bytes.
+   *
+   * Purpose: To report how births and deaths are using the organism pool.
+   * The pool is shared by every world in the process.
+   */
+  OrganismPool::Stats GetAllocationStats() {return OrganismPool::GetStats();}
+
+  /**
+   * Input: None
+   *
+   * Output: The number of times a cell has been processed by event-driven updates.
+   *
+   * Purpose: To report how much work the event queue has saved.
+   */
+  size_t GetCellsProcessed() {return events.GetCellsProcessed();}
+
+  /**
+   * Input: The location of the cell.
+   *
+   * Output: The update in which the cell is next processed by event-driven updates.
+   *
+   * Purpose: To look up a cell's place in the event queue.
+   */
+  size_t GetCellWakeUpdate(size_t i) {return events.GetCellWakeUpdate(i);}
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To bring every cell up to the current update during event-driven
+   * updates, so that the population can be sampled.
+   */
+  void CatchUpAllCells() {events.CatchUpAllCells(*this);}
+
+  /**
+   * Input: The location of a cell that another cell is about to change.
+   *
+   * Output: None
+   *
+   * Purpose: To bring a cell up to date before another cell places an organism
+   * in it or infects its host during event-driven updates, and to make sure it
+   * is processed again in the next update.
+   */
+  void WakeCell(size_t i) {events.WakeCell(*this, i);}
+
+  /**
+   * Input: The location of the cell about to be processed.
+   *
+   * Output: None
+   *
+   * Purpose: To have the world and its organisms draw from the cell's
+   * counter-based stream (COUNTER_RNG) while the cell is processed outside
+   * of tiles.
+   */
+  void UseCellStream(size_t i) {
+    GetStreamRandom().ResetSeed(GetStreamSeed(CELL_STREAM, i));
+    thread_random = stream_random;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To go back to drawing from the world's generator after UseCellStream.
+   */
+  void EndCellStream() {thread_random = nullptr;}
+
   /**
    * Input: None
    *
@@ -684,7 +1581,15 @@ public:
    * Purpose: To simulate a timestep in the world, which includes calling the process functions for hosts and symbionts and updating the data nodes.
    */
   void Update() {
+    if (my_config->EVENT_DRIVEN() && GetUpdate() % my_config->DATA_INT() == 0) {
+      CatchUpAllCells(); //the data files are written from the population as it stands
+    }
+    if (memory_report_file.is_open() && GetUpdate() % my_config->DATA_INT() == 0) {
+      WriteMemoryReport();
+    }
     emp::World<Organism>::Update();
+    //the sparse free-living layer can't be written from several threads at once
+    if (free_living_layer) sym_pop.ChooseForm(!CanUpdateInParallel() || my_config->THREADS() <= 1);
 
     // Handle resource inflow
     if (total_res != -1) {
@@ -692,22 +1597,33 @@ public:
     }
 
     if(my_config->PHYLOGENY()) sym_sys->Update(); //sym_sys is not part of the systematics vector, handle it independently
-    emp::vector<size_t> schedule = emp::GetPermutation(GetRandom(), GetSize());
+    if (my_config->EVENT_DRIVEN()) {
+      events.Run(*this);
+      if (my_config->SYNCHRONOUS()) pending.Apply(*this);
+      return;
+    }
+    if (CanUpdateInParallel()) {
+      UpdateTiles();
+      if (my_config->SYNCHRONOUS()) pending.Apply(*this);
+      return;
+    }
+    if (my_config->SKIP_EMPTY_CELLS()) {
+      // only visit the cells that are occupied at the start of the update
+      schedule.assign(active_cells.GetCells().begin(), active_cells.GetCells().end());
+      emp::Shuffle(GetRandom(), schedule);
+    } else {
+      FillPermutation(GetRandom(), schedule, GetSize());
+    }
     // divvy up and distribute resources to host and symbiont in each cell
     for (size_t i : schedule) {
-      if (IsOccupied(i) == false && !sym_pop[i]){ continue;} // no organism at that cell
-      if(IsOccupied(i)){//can't call GetDead on a deleted sym, so
-        pop[i]->Process(i);
-        if (pop[i]->GetDead()) { //Check if the host died
-          DoDeath(i);
-        }
-      }
-      if(sym_pop[i]){ //for sym movement reasons, syms are deleted the update after they are set to dead
-        emp::WorldPosition sym_pos = emp::WorldPosition(0,i);
-        if (sym_pop[i]->GetDead()) DoSymDeath(i); //Might have died since their last time being processed
-        else sym_pop[i]->Process(sym_pos); //index 0, since it's freeliving, and id its location in the world
+      if (my_config->COUNTER_RNG()) {
+        GetStreamRandom().ResetSeed(GetStreamSeed(CELL_STREAM, i));
+        thread_random = stream_random;
       }
+      ProcessCell(i);
     } // for each cell in schedule
+    thread_random = nullptr;
+    if (my_config->SYNCHRONOUS()) pending.Apply(*this);
   } // Update()
 };// SymWorld class
 #endif
@@ -0,0 +1,101 @@
+#ifndef SYMWORLDT_H
+#define SYMWORLDT_H
+
+#include "SymWorld.h"
+
+/**
+ * A world whose hosts are all exactly HOST and whose symbionts are all
+ * exactly SYM. Knowing this, it processes each cell with the organisms'
+ * methods bound at compile time, so the compiler can inline the per-cell
+ * pipeline instead of calling through Organism's vtable. WORLD is the mode's
+ * world (SymWorld, LysisWorld, EfficientWorld or PGGWorld); the native builds
+ * use this, while the tests and the web build use the mode's world directly.
+ * Once the world is set up, each cell is processed by a kernel compiled for
+ * the feature switches in the world's config snapshot, so the features that
+ * are off cost nothing.
+ */
+template <typename WORLD, typename HOST, typename SYM>
+class SymWorldT final : public WORLD {
+private:
+  using Kernel = void (SymWorldT::*)(size_t);
+
+  /**
+    *
+    * Purpose: Represents the kernel that processes a cell, specialized for
+    * the feature switches in the world's config snapshot. It is picked again
+    * whenever the snapshot is retaken.
+    *
+  */
+  Kernel kernel = &SymWorldT::ProcessCellLive;
+
+  /**
+   * Input: The size_t representing the cell to be processed.
+   *
+   * Output: None
+   *
+   * Purpose: To process a cell reading the settings from the config, for
+   * before the world has frozen them.
+   */
+  void ProcessCellLive(size_t i) {ProcessCellAs<HOST, SYM>(*this, i, LiveParams(*this->my_config));}
+
+  /**
+   * Input: The feature switches the kernel is compiled for, and the size_t
+   * representing the cell to be processed.
+   *
+   * Output: None
+   *
+   * Purpose: To process a cell with the feature switches fixed at compile
+   * time, and the other settings read from the snapshot.
+   */
+  template <bool FREE_LIVING_SYMS, bool ECTOSYMBIOSIS, bool HORIZ_TRANS, bool SYNCHRONOUS>
+  void ProcessCellFrozen(size_t i) {
+    FrozenParams<FREE_LIVING_SYMS, ECTOSYMBIOSIS, HORIZ_TRANS, SYNCHRONOUS> params(this->config_snapshot);
+    ProcessCellAs<HOST, SYM>(*this, i, params);
+  }
+
+  /**
+   * Input: The switches chosen so far, and the snapshot.
+   *
+   * Output: The kernel compiled for the snapshot's feature switches.
+   *
+   * Purpose: To pick the kernel instantiation that matches the snapshot,
+   * one switch at a time.
+   */
+  template <bool... SWITCHES>
+  Kernel SelectKernel(const ConfigSnapshot & snapshot) {
+    if constexpr (sizeof...(SWITCHES) == 4) {
+      return &SymWorldT::ProcessCellFrozen<SWITCHES...>;
+    } else {
+      const bool next[] = {snapshot.free_living_syms, snapshot.ectosymbiosis,
+        snapshot.horiz_trans, snapshot.synchronous};
+      if (next[sizeof...(SWITCHES)]) return SelectKernel<SWITCHES..., true>(snapshot);
+      return SelectKernel<SWITCHES..., false>(snapshot);
+    }
+  }
+
+public:
+  using WORLD::WORLD;
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To take a new snapshot of the settings and pick the kernel
+   * that matches it.
+   */
+  void FreezeConfig() override {
+    WORLD::FreezeConfig();
+    kernel = SelectKernel(this->config_snapshot);
+  }
+
+  /**
+   * Input: The size_t representing the cell to be processed.
+   *
+   * Output: None
+   *
+   * Purpose: To process the host and the free-living symbiont in a cell.
+   */
+  void ProcessCell(size_t i) override {(this->*kernel)(i);}
+};
+#endif
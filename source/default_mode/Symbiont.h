@@ -18,7 +18,7 @@ protected:
     * one represents mutualism. Zero is a neutral value.
     *
   */
-  double interaction_val = 0;
+  trait_t interaction_val = 0;
 
   /**
     *
@@ -42,7 +42,7 @@ protected:
     * a free-living sym will infect a parallel host on process
     *
   */
-  double infection_chance = 0.0;
+  trait_t infection_chance = 0.0;
 
   /**
     *
@@ -54,17 +54,11 @@ protected:
 
   /**
     *
-    * Purpose: Represents an instance of random.
+    * Purpose: Represents the random number generator, world and configuration
+    * settings the symbiont lives with, which are shared by every organism of its world.
     *
   */
-  emp::Ptr<emp::Random> random = NULL;
-
-  /**
-    *
-    * Purpose: Represents the world that the hosts are living in.
-    *
-  */
-  emp::Ptr<SymWorld> my_world = NULL;
+  emp::Ptr<OrganismContext> context = NULL;
 
   /**
     *
@@ -73,13 +67,6 @@ protected:
   */
   emp::Ptr<Organism> my_host = NULL;
 
-  /**
-    *
-    * Purpose: Represents the configuration settings for a particular run.
-    *
-  */
-  emp::Ptr<SymConfigBase> my_config = NULL;
-
   /**
     *
     * Purpose: Tracks the taxon of this organism.
@@ -91,14 +78,17 @@ public:
   /**
    * The constructor for symbiont
    */
-  Symbiont(emp::Ptr<emp::Random> _random, emp::Ptr<SymWorld> _world, emp::Ptr<SymConfigBase> _config, double _intval=0.0, double _points = 0.0) :  interaction_val(_intval), points(_points), random(_random), my_world(_world), my_config(_config) {
-    infection_chance = my_config->SYM_INFECTION_CHANCE();
-    if (infection_chance == -2) infection_chance = random->GetDouble(0,1); //randomized starting infection chance
-    if (infection_chance > 1 || infection_chance < 0) throw "Invalid infection chance. Must be between 0 and 1"; //exception for invalid infection chance
+  Symbiont(emp::Ptr<emp::Random> _random, emp::Ptr<SymWorld> _world, emp::Ptr<SymConfigBase> _config, double _intval=0.0, double _points = 0.0) :  interaction_val(_intval), points(_points),
+  context(OrganismContext::Get(_random, _world, _config)) {
+    //checked before being stored, since reduced-precision traits clamp what they store
+    double start_chance = GetConfig()->SYM_INFECTION_CHANCE();
+    if (start_chance == -2) start_chance = GetRandom().GetDouble(0,1); //randomized starting infection chance
+    if (start_chance > 1 || start_chance < 0) throw "Invalid infection chance. Must be between 0 and 1"; //exception for invalid infection chance
+    infection_chance = start_chance;
     if (_intval == -2) {
-      interaction_val = random->GetDouble(-1, 1);
+      interaction_val = GetRandom().GetDouble(-1, 1);
     }
-   if (interaction_val > 1 || interaction_val < -1) {
+   else if (_intval > 1 || _intval < -1) {
        throw "Invalid interaction value. Must be between -1 and 1";   // Exception for invalid interaction value
     };
   }
@@ -153,6 +143,35 @@ public:
    */
   Symbiont & operator=(Symbiont &&) = default;
 
+
+  /**
+   * Input: None
+   *
+   * Output: The random number generator the symbiont should draw from.
+   *
+   * Purpose: To draw from the world's tile or cell stream while the world is
+   * processing tiles or using COUNTER_RNG, and from the symbiont's own generator otherwise.
+   */
+  emp::Random & GetRandom() { return SymWorld::GetThreadRandom(context->random); }
+
+  /**
+   * Input: None
+   *
+   * Output: The world the symbiont lives in.
+   *
+   * Purpose: To get the symbiont's world.
+   */
+  emp::Ptr<SymWorld> GetWorld() {return context->world;}
+
+  /**
+   * Input: None
+   *
+   * Output: The configuration settings for the run.
+   *
+   * Purpose: To get the symbiont's configuration settings.
+   */
+  emp::Ptr<SymConfigBase> GetConfig() {return context->config;}
+
   /**
    * Input: None
    *
@@ -161,7 +180,7 @@ public:
    * Purpose: To destruct the symbiont and remove the symbiont from the systematic.
    */
   ~Symbiont() {
-    if(my_config->PHYLOGENY() == 1) {my_world->GetSymSys()->RemoveOrg(my_taxon, my_world->GetUpdate());}
+    if(GetConfig()->PHYLOGENY() == 1) {GetWorld()->GetSymSys()->RemoveOrg(my_taxon, GetWorld()->GetUpdate());}
   }
 
     /**
@@ -175,6 +194,17 @@ public:
       return  "Symbiont";
     }
 
+    /**
+    * Input: None
+    *
+    * Output: The size in bytes of a Symbiont object
+    *
+    * Purpose: To account for the memory organisms take up by their exact type
+    */
+    size_t GetObjectSize() {
+      return sizeof(Symbiont);
+    }
+
 
   /**
    * Input: None
@@ -183,7 +213,7 @@ public:
    *
    * Purpose: To get a symbiont's interaction value.
    */
-  double GetIntVal() const {return interaction_val;}
+  double GetIntVal() const final {return interaction_val;}
 
 
   /**
@@ -193,7 +223,7 @@ public:
    *
    * Purpose: To get a symbiont's points.
    */
-  double GetPoints() {return points;}
+  double GetPoints() final {return points;}
 
 
   /**
@@ -224,7 +254,7 @@ public:
    *
    * Purpose: To determine a symbiont's infection chance
    */
-  double GetInfectionChance() {return infection_chance;}
+  double GetInfectionChance() final {return infection_chance;}
 
 
   /**
@@ -234,7 +264,7 @@ public:
    *
    * Purpose: To retrieve a symbiont's host
    */
-  emp::Ptr<Organism> GetHost() {return my_host;}
+  emp::Ptr<Organism> GetHost() final {return my_host;}
 
 
   /**
@@ -265,7 +295,7 @@ public:
    *
    * Purpose: To set a symbiont to dead
    */
-  void SetDead() { dead = true; }
+  void SetDead() final { dead = true; }
 
 
   /**
@@ -275,7 +305,7 @@ public:
    *
    * Purpose: To determine if a symbiont is dead
    */
-  bool GetDead() { return dead; }
+  bool GetDead() final { return dead; }
 
 
   /**
@@ -302,7 +332,7 @@ public:
    *
    * Purpose: To set a symbiont's points
    */
-  void SetPoints(double _in) {points = _in;}
+  void SetPoints(double _in) final {points = _in;}
 
 
   /**
@@ -321,7 +351,7 @@ public:
    *
    * Purpose: To get the Symbiont's age.
    */
-  int GetAge() {return age;}
+  int GetAge() final {return age;}
 
   /**
    * Input: An int of what age the Symbiont should be set to
@@ -330,7 +360,7 @@ public:
    *
    * Purpose: To set the Symbiont's age for testing purposes.
    */
-  void SetAge(int _in) {age = _in;}
+  void SetAge(int _in) final {age = _in;}
 
   /**
    * Input: The pointer to an organism that will be set as the symbinot's host
@@ -339,7 +369,7 @@ public:
    *
    * Purpose: To set a symbiont's host
    */
-  void SetHost(emp::Ptr<Organism> _in) {my_host = _in;}
+  void SetHost(emp::Ptr<Organism> _in) final {my_host = _in;}
 
   /**
    * Input: The double that will be the symbiont's infection chance
@@ -374,9 +404,18 @@ public:
    *
    * Purpose: Increments age by one and kills it if too old.
    */
-  void GrowOlder(){
+  void GrowOlder(){GrowOlder(GetConfig()->SYM_AGE_MAX());}
+
+  /**
+   * Input: The maximum age symbionts may reach (-1 for no limit).
+   *
+   * Output: None
+   *
+   * Purpose: Increments age by one and kills it if too old.
+   */
+  void GrowOlder(int age_max){
     age = age + 1;
-    if(age > my_config->SYM_AGE_MAX() && my_config->SYM_AGE_MAX() > 0){
+    if(age > age_max && age_max > 0){
       SetDead();
     }
   }
@@ -392,17 +431,17 @@ public:
    * deviation.
    */
   void Mutate(){
-    double local_rate = my_config->MUTATION_RATE();
-    double local_size = my_config->MUTATION_SIZE();
+    double local_rate = GetConfig()->MUTATION_RATE();
+    double local_size = GetConfig()->MUTATION_SIZE();
 
-    if (random->GetDouble(0.0, 1.0) <= local_rate) {
-      interaction_val += random->GetRandNormal(0.0, local_size);
+    if (GetRandom().GetDouble(0.0, 1.0) <= local_rate) {
+      interaction_val += GetRandom().GetRandNormal(0.0, local_size);
       if(interaction_val < -1) interaction_val = -1;
       else if (interaction_val > 1) interaction_val = 1;
 
       //also modify infection chance, which is between 0 and 1
-      if(my_config->FREE_LIVING_SYMS()){
-        infection_chance += random->GetRandNormal(0.0, local_size);
+      if(GetConfig()->FREE_LIVING_SYMS()){
+        infection_chance += GetRandom().GetRandNormal(0.0, local_size);
         if (infection_chance < 0) infection_chance = 0;
         else if (infection_chance > 1) infection_chance = 1;
       }
@@ -425,7 +464,7 @@ public:
     double sym_int_val = GetIntVal();
     double sym_portion = 0;
     double host_portion = 0;
-    double synergy = my_config->SYNERGY();
+    double synergy = GetConfig()->SYNERGY();
 
     if (sym_int_val<0){
       double stolen = host->StealResources(sym_int_val);
@@ -451,7 +490,7 @@ public:
    * infect a host based upon its infection chance
    */
   bool WantsToInfect(){
-    bool result = random->GetDouble(0.0, 1.0) < infection_chance;
+    bool result = GetRandom().GetDouble(0.0, 1.0) < infection_chance;
     return result;
   }
 
@@ -467,7 +506,7 @@ public:
    */
   bool InfectionFails(){
     //note: this can be returned true, and an infecting sym can then be killed by a host that is already infected.
-    bool sym_dies = random->GetDouble(0.0, 1.0) < my_config->SYM_INFECTION_FAILURE_RATE();
+    bool sym_dies = GetRandom().GetDouble(0.0, 1.0) < GetConfig()->SYM_INFECTION_FAILURE_RATE();
     return sym_dies;
   }
 
@@ -504,20 +543,31 @@ public:
    * and to allow for movement
    */
    //size_t rank=-1
-  void Process(emp::WorldPosition location) {
+  void Process(emp::WorldPosition location) {ProcessWith(location, LiveParams(*GetConfig()));}
+
+  /**
+   * Input: The location of the symbiont, and the settings to process it with.
+   *
+   * Output: None
+   *
+   * Purpose: To process the symbiont as Process() does, with the settings
+   * read from a snapshot when the world has frozen them.
+   */
+  template <typename PARAMS>
+  void ProcessWith(emp::WorldPosition location, const PARAMS & params) {
     //ID is where they are in the world, INDEX is where they are in the host's symbiont list (or 0 if they're free living)
-    if (my_host.IsNull() && my_config->FREE_LIVING_SYMS()) { //free living symbiont
-      double resources = my_world->PullResources(my_config->FREE_SYM_RES_DISTRIBUTE()); //receive resources from the world
+    if (params.FreeLivingSyms() && my_host.IsNull()) { //free living symbiont
+      double resources = GetWorld()->PullResources(params.FreeSymResDistribute()); //receive resources from the world
       LoseResources(resources);
     }
     //Check if horizontal transmission can occur and do it
-    HorizontalTransmission(location);
+    if (params.HorizTrans()) HorizontalTransmission(location);
     //Age the organism
-    GrowOlder();
+    GrowOlder(params.SymAgeMax());
     //Check if the organism should move and do it
-    if (my_host.IsNull() && my_config->FREE_LIVING_SYMS() && !dead) {
+    if (params.FreeLivingSyms() && my_host.IsNull() && !dead) {
       //if the symbiont should move, and hasn't been killed
-      my_world->MoveFreeSym(location);
+      GetWorld()->MoveFreeSym(location);
     }
   }
 
@@ -529,7 +579,7 @@ public:
    * Purpose: To produce a new symbiont, identical to the original
    */
   emp::Ptr<Organism> MakeNew() {
-    emp::Ptr<Symbiont> new_sym = emp::NewPtr<Symbiont>(random, my_world, my_config, GetIntVal());
+    emp::Ptr<Symbiont> new_sym = emp::NewPtr<Symbiont>(context->random, GetWorld(), GetConfig(), GetIntVal());
     new_sym->SetInfectionChance(GetInfectionChance());
     return new_sym;
   }
@@ -545,8 +595,8 @@ public:
     emp::Ptr<Organism> sym_baby = MakeNew();
     sym_baby->Mutate();
 
-    if(my_config->PHYLOGENY() == 1){
-      my_world->AddSymToSystematic(sym_baby, my_taxon);
+    if(GetConfig()->PHYLOGENY() == 1){
+      GetWorld()->AddSymToSystematic(sym_baby, my_taxon);
       //baby's taxon will be set in AddSymToSystematic
     }
     return sym_baby;
@@ -560,13 +610,14 @@ public:
    * Purpose: To allow for vertical transmission to occur
    */
   void VerticalTransmission(emp::Ptr<Organism> host_baby) {
-    if((my_world->WillTransmit()) && GetPoints() >= my_config->SYM_VERT_TRANS_RES()){ //if the world permits vertical tranmission and the sym has enough resources, transmit!
+    if((GetWorld()->WillTransmit()) && GetPoints() >= GetConfig()->SYM_VERT_TRANS_RES()){ //if the world permits vertical tranmission and the sym has enough resources, transmit!
       emp::Ptr<Organism> sym_baby = Reproduce();
-      points = points - my_config->SYM_VERT_TRANS_RES();
+      points = points - GetConfig()->SYM_VERT_TRANS_RES();
       host_baby->AddSymbiont(sym_baby);
 
       //vertical transmission data node
-      emp::DataMonitor<int>& data_node_attempts_verttrans = my_world->GetVerticalTransmissionAttemptCount();
+      std::unique_lock<std::mutex> lock = GetWorld()->LockSharedState();
+      emp::DataMonitor<int>& data_node_attempts_verttrans = GetWorld()->GetVerticalTransmissionAttemptCount();
       data_node_attempts_verttrans.AddDatum(1);
     }
   }
@@ -579,24 +630,25 @@ public:
    * Purpose: To check and allow for horizontal transmission to occur
    */
   void HorizontalTransmission(emp::WorldPosition location) {
-    if (my_config->HORIZ_TRANS()) { //non-lytic horizontal transmission enabled
-      double required_points = my_config->SYM_HORIZ_TRANS_RES();
-      if (my_config->FREE_LIVING_SYMS() && my_host == nullptr && my_config->FREE_SYM_REPRO_RES() > -1) {
-        required_points = my_config->FREE_SYM_REPRO_RES();
+    if (GetConfig()->HORIZ_TRANS()) { //non-lytic horizontal transmission enabled
+      double required_points = GetConfig()->SYM_HORIZ_TRANS_RES();
+      if (GetConfig()->FREE_LIVING_SYMS() && my_host == nullptr && GetConfig()->FREE_SYM_REPRO_RES() > -1) {
+        required_points = GetConfig()->FREE_SYM_REPRO_RES();
       }
       if (GetPoints() >= required_points) {
         // symbiont reproduces independently (horizontal transmission) if it has enough resources
         //TODO: try just subtracting points to be consistent with vertical transmission
-        //points = points - my_config->SYM_HORIZ_TRANS_RES();
+        //points = points - GetConfig()->SYM_HORIZ_TRANS_RES();
         SetPoints(0);
         emp::Ptr<Organism> sym_baby = Reproduce();
-        emp::WorldPosition new_pos = my_world->SymDoBirth(sym_baby, location);
+        emp::WorldPosition new_pos = GetWorld()->SymDoBirth(sym_baby, location);
 
         //horizontal transmission data nodes
-        emp::DataMonitor<int>& data_node_attempts_horiztrans = my_world->GetHorizontalTransmissionAttemptCount();
+        std::unique_lock<std::mutex> lock = GetWorld()->LockSharedState();
+        emp::DataMonitor<int>& data_node_attempts_horiztrans = GetWorld()->GetHorizontalTransmissionAttemptCount();
         data_node_attempts_horiztrans.AddDatum(1);
 
-        emp::DataMonitor<int>& data_node_successes_horiztrans = my_world->GetHorizontalTransmissionSuccessCount();
+        emp::DataMonitor<int>& data_node_successes_horiztrans = GetWorld()->GetHorizontalTransmissionSuccessCount();
         if(new_pos.IsValid()){
           data_node_successes_horiztrans.AddDatum(1);
         }
@@ -0,0 +1,130 @@
+#ifndef SYNCHRONOUS_UPDATE_H
+#define SYNCHRONOUS_UPDATE_H
+
+#include "../../Empirical/include/emp/Evolve/World.hpp"
+#include "../../Empirical/include/emp/math/random_utils.hpp"
+#include "../Organism.h"
+#include <algorithm>
+
+/**
+ * The changes a synchronous update (SYNCHRONOUS 1) holds back until every
+ * cell has been processed, so that no cell sees what another did in the
+ * same update: host offspring, symbiont offspring or moving free-living
+ * symbionts headed for another cell, and hosts that died. The world holds
+ * changes back as its cells are processed (under its shared-state lock
+ * during threaded updates) and applies them at the end of the update.
+ */
+class SynchronousUpdate {
+private:
+  /**
+    *
+    * Purpose: Represent the changes held back. Each change records the cell
+    * it came from.
+    *
+  */
+  struct PendingHost {
+    emp::Ptr<Organism> host;
+    size_t origin;
+    emp::WorldPosition pos;
+  };
+  struct PendingSym {
+    emp::Ptr<Organism> sym;
+    size_t origin;
+    size_t target;
+    bool into_host;
+  };
+  emp::vector<PendingHost> pending_hosts;
+  emp::vector<PendingSym> pending_syms;
+  emp::vector<size_t> pending_deaths;
+
+  /**
+   * Input: The vector of pending changes to be ordered, and the random number generator to use.
+   *
+   * Output: None
+   *
+   * Purpose: To put pending changes in a random order that does not depend on
+   * which threads recorded them: they are first sorted by the cell they came
+   * from (keeping each cell's changes in order) and then shuffled.
+   */
+  template <typename T>
+  static void OrderPendingChanges(emp::vector<T> & changes, emp::Random & random) {
+    std::stable_sort(changes.begin(), changes.end(),
+      [](const T & a, const T & b) { return a.origin < b.origin; });
+    emp::Shuffle(random, changes);
+  }
+
+public:
+  /**
+   * Input: The host offspring, the cell of its parent, and the position it is headed for.
+   *
+   * Output: None
+   *
+   * Purpose: To hold back a host's birth until the end of the update.
+   */
+  void HoldHost(emp::Ptr<Organism> host, size_t origin, emp::WorldPosition pos) {
+    pending_hosts.push_back({host, origin, pos});
+  }
+
+  /**
+   * Input: The symbiont, the cell it comes from, the cell it is headed for,
+   * and whether it is to infect the host there (rather than settle as a
+   * free-living symbiont).
+   *
+   * Output: None
+   *
+   * Purpose: To hold back a symbiont's move until the end of the update.
+   */
+  void HoldSym(emp::Ptr<Organism> sym, size_t origin, size_t target, bool into_host) {
+    pending_syms.push_back({sym, origin, target, into_host});
+  }
+
+  /**
+   * Input: The cell of a host that died.
+   *
+   * Output: None
+   *
+   * Purpose: To leave a dead host in its cell until the end of the update.
+   */
+  void HoldDeath(size_t i) {pending_deaths.push_back(i);}
+
+  /**
+   * Input: The world the changes were held back in.
+   *
+   * Output: None
+   *
+   * Purpose: To end a synchronous update by applying the changes that were held
+   * back while cells were processed: dead hosts are removed, host offspring are
+   * placed, and then symbionts infect the host in their target cell or settle
+   * in it as free-living symbionts. The births and moves are each put in an
+   * order drawn from the world's GetPendingOrderRandom.
+   */
+  template <typename WORLD>
+  void Apply(WORLD & world) {
+    for (size_t i : pending_deaths) {
+      if (world.IsOccupied(i) && world.GetOrg(i).GetDead()) world.DoDeath(i);
+    }
+    pending_deaths.resize(0);
+
+    OrderPendingChanges(pending_hosts, world.GetPendingOrderRandom());
+    for (PendingHost & birth : pending_hosts) {
+      world.AddOrgAt(birth.host, birth.pos, birth.origin);
+    }
+    pending_hosts.resize(0);
+
+    OrderPendingChanges(pending_syms, world.GetPendingOrderRandom());
+    for (PendingSym & placement : pending_syms) {
+      if (placement.into_host) {
+        world.WakeCell(placement.target);
+        if (world.IsOccupied(placement.target) && world.GetOrg(placement.target).AddSymbiont(placement.sym) > 0) {
+          world.GetHorizontalTransmissionSuccessCount().AddDatum(1);
+        } else if (!world.IsOccupied(placement.target)) {
+          placement.sym.Delete();
+        }
+      } else {
+        world.AddOrgAt(placement.sym, emp::WorldPosition(0, placement.target), emp::WorldPosition(0, placement.origin));
+      }
+    }
+    pending_syms.resize(0);
+  }
+};
+#endif
@@ -0,0 +1,186 @@
+#ifndef TILED_UPDATE_H
+#define TILED_UPDATE_H
+
+#include "../../Empirical/include/emp/base/Ptr.hpp"
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include "../../Empirical/include/emp/math/Random.hpp"
+#include "../../Empirical/include/emp/math/random_utils.hpp"
+#include "WorkerPool.h"
+#include <algorithm>
+#include <atomic>
+
+/**
+ * The checkerboard tiles a grid world is split into for threaded updates
+ * (see SymWorld::UpdateTiles). Tiles are coloured by the parity of their
+ * column and row, so tiles of one colour are at least two cells apart and
+ * can be processed at the same time. Each tile owns a random stream and a
+ * buffer for its cell schedule, and the tiles of a colour are handed out to
+ * the threads of a worker pool that lasts as long as the tiles do.
+ */
+class TiledUpdate {
+public:
+  /**
+    *
+    * Purpose: Represents the preferred width (in cells) of the tiles a grid
+    * is split into. Tiles are never narrower than 2 cells.
+    *
+  */
+  static constexpr size_t TILE_WIDTH = 8;
+
+private:
+  size_t width = 0;
+  size_t height = 0;
+  bool one_colour = false;
+
+  /**
+    *
+    * Purpose: Represent the tiles. The tile bounds hold the first column/row
+    * of each tile (plus the grid width/height), the tiles are listed by their
+    * colour, and each tile owns a random stream that is reseeded at the start
+    * of every update and a schedule buffer that is refilled in place.
+    *
+  */
+  emp::vector<size_t> bounds_x;
+  emp::vector<size_t> bounds_y;
+  emp::vector<emp::vector<size_t>> tiles_by_colour;
+  emp::vector<size_t> colour_order;
+  emp::vector<emp::Ptr<emp::Random>> randoms;
+  emp::vector<emp::vector<size_t>> schedules;
+
+  /**
+    *
+    * Purpose: Represents the threads the tiles are processed on.
+    *
+  */
+  WorkerPool pool;
+
+public:
+  TiledUpdate() = default;
+  TiledUpdate(const TiledUpdate &) = delete;
+  TiledUpdate & operator=(const TiledUpdate &) = delete;
+
+  ~TiledUpdate() {
+    for (size_t i = 0; i < randoms.size(); i++) randoms[i].Delete();
+  }
+
+  /**
+   * Input: The length of a grid axis.
+   *
+   * Output: The first position of each tile along the axis, followed by the axis length.
+   *
+   * Purpose: To split a grid axis into tiles. There is either a single tile or
+   * an even number of tiles that are at least two cells wide, so that tiles of
+   * the same colour never neighbor each other, even across the wrap.
+   */
+  static emp::vector<size_t> GetTileBounds(size_t length) {
+    size_t num_tiles = std::max(length / TILE_WIDTH, (size_t) 2);
+    num_tiles = std::min(num_tiles, length / 2);
+    num_tiles -= num_tiles % 2;
+    if (num_tiles < 2) num_tiles = 1;
+
+    emp::vector<size_t> bounds(num_tiles + 1);
+    for (size_t i = 0; i <= num_tiles; i++) bounds[i] = i * length / num_tiles;
+    return bounds;
+  }
+
+  /**
+   * Input: The width and height of the grid, and whether every tile can run at
+   * once (as in synchronous updates, which only change other cells at the end).
+   *
+   * Output: Whether the tiles were set up for that grid.
+   *
+   * Purpose: To check whether the tiles need to be set up (again).
+   */
+  bool IsSetUp(size_t _width, size_t _height, bool _one_colour) const {
+    return bounds_x.size() > 0 && width == _width && height == _height && one_colour == _one_colour;
+  }
+
+  /**
+   * Input: The width and height of the grid, and whether every tile can run at once.
+   *
+   * Output: None
+   *
+   * Purpose: To split the grid into tiles and colour them like a checkerboard.
+   */
+  void Setup(size_t _width, size_t _height, bool _one_colour) {
+    width = _width;
+    height = _height;
+    one_colour = _one_colour;
+    bounds_x = GetTileBounds(width);
+    bounds_y = GetTileBounds(height);
+    size_t num_tiles_x = bounds_x.size() - 1;
+    size_t num_tiles_y = bounds_y.size() - 1;
+
+    tiles_by_colour.resize(4);
+    for (size_t colour = 0; colour < 4; colour++) tiles_by_colour[colour].resize(0);
+    for (size_t tile_y = 0; tile_y < num_tiles_y; tile_y++) {
+      for (size_t tile_x = 0; tile_x < num_tiles_x; tile_x++) {
+        size_t colour = one_colour ? 0 : (tile_x % 2) + 2 * (tile_y % 2);
+        tiles_by_colour[colour].push_back(tile_x + tile_y * num_tiles_x);
+      }
+    }
+
+    while (randoms.size() < num_tiles_x * num_tiles_y) {
+      randoms.push_back(emp::NewPtr<emp::Random>(1));
+    }
+    schedules.resize(num_tiles_x * num_tiles_y);
+  }
+
+  size_t GetNumTiles() const {return (bounds_x.size() - 1) * (bounds_y.size() - 1);}
+  emp::Ptr<emp::Random> GetTileRandom(size_t tile) {return randoms[tile];}
+  size_t GetNumWorkers() const {return pool.GetNumWorkers();}
+
+  /**
+   * Input: The random number generator to use.
+   *
+   * Output: None
+   *
+   * Purpose: To pick the order in which the colours are processed this update.
+   */
+  void ShuffleColours(emp::Random & random) {
+    colour_order = {0, 1, 2, 3};
+    emp::Shuffle(random, colour_order);
+  }
+
+  /**
+   * Input: The size_t id of a tile.
+   *
+   * Output: The tile's schedule buffer, filled with its cells row by row.
+   *
+   * Purpose: To list the cells of a tile without allocating.
+   */
+  emp::vector<size_t> & GetTileCells(size_t tile) {
+    size_t num_tiles_x = bounds_x.size() - 1;
+    size_t tile_x = tile % num_tiles_x;
+    size_t tile_y = tile / num_tiles_x;
+
+    emp::vector<size_t> & cells = schedules[tile];
+    cells.resize(0);
+    for (size_t y = bounds_y[tile_y]; y < bounds_y[tile_y + 1]; y++) {
+      for (size_t x = bounds_x[tile_x]; x < bounds_x[tile_x + 1]; x++) {
+        cells.push_back(x + y * width);
+      }
+    }
+    return cells;
+  }
+
+  /**
+   * Input: The number of threads to use, and the function that processes a tile.
+   *
+   * Output: None
+   *
+   * Purpose: To process every tile, one colour at a time in the shuffled
+   * order, handing the tiles of a colour out to the pool's threads.
+   */
+  template <typename FUN>
+  void Run(size_t num_threads, FUN && process_tile) {
+    for (size_t colour : colour_order) {
+      const emp::vector<size_t> & tiles = tiles_by_colour[colour];
+      std::atomic<size_t> next_tile(0);
+      pool.Run(std::min(num_threads, tiles.size()), [&tiles, &next_tile, &process_tile]() {
+        for (size_t t = next_tile++; t < tiles.size(); t = next_tile++) process_tile(tiles[t]);
+      });
+    }
+  }
+};
+#endif
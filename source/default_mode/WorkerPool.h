@@ -0,0 +1,118 @@
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/**
+ * A set of worker threads that live as long as the pool does. Run hands a
+ * job to some of them and runs it on the calling thread as well, so a world
+ * that runs a threaded pass every update keeps the same threads (and their
+ * thread_local state) for its whole life instead of starting new ones.
+ */
+class WorkerPool {
+private:
+  emp::vector<std::thread> workers;
+
+  /**
+    *
+    * Purpose: Guards the job and the counters below, which the workers wait on.
+    *
+  */
+  std::mutex mutex;
+  std::condition_variable start_cv;
+  std::condition_variable done_cv;
+
+  /**
+    *
+    * Purpose: Represents the job of the current round, the number of workers
+    * asked to run it (the ones with an id below num_active), the number of
+    * them still running it, and the number of the round, which the workers
+    * watch for a new job.
+    *
+  */
+  std::function<void()> job;
+  size_t num_active = 0;
+  size_t num_running = 0;
+  size_t round = 0;
+  bool stopping = false;
+
+  /**
+   * Input: The id of the worker.
+   *
+   * Output: None
+   *
+   * Purpose: To wait for rounds and run the ones this worker is part of,
+   * until the pool is destroyed.
+   */
+  void Work(size_t id) {
+    size_t seen_round = 0;
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+      start_cv.wait(lock, [this, &seen_round]() { return stopping || round != seen_round; });
+      if (stopping) return;
+      seen_round = round;
+      if (id >= num_active) continue;
+      lock.unlock();
+      job();
+      lock.lock();
+      if (--num_running == 0) done_cv.notify_one();
+    }
+  }
+
+public:
+  WorkerPool() = default;
+  WorkerPool(const WorkerPool &) = delete;
+  WorkerPool & operator=(const WorkerPool &) = delete;
+
+  ~WorkerPool() {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      stopping = true;
+    }
+    start_cv.notify_all();
+    for (std::thread & worker : workers) worker.join();
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The number of worker threads the pool has started.
+   *
+   * Purpose: To check how many threads the pool keeps.
+   */
+  size_t GetNumWorkers() const {return workers.size();}
+
+  /**
+   * Input: The number of threads to run the job on (the calling thread
+   * included), and the job.
+   *
+   * Output: None
+   *
+   * Purpose: To run a job on several threads at once and wait for all of them
+   * to finish it. Workers are only started the first time they are needed.
+   */
+  void Run(size_t num_threads, const std::function<void()> & _job) {
+    size_t num_helpers = num_threads > 1 ? num_threads - 1 : 0;
+    if (num_helpers == 0) {
+      _job();
+      return;
+    }
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      while (workers.size() < num_helpers) workers.emplace_back(&WorkerPool::Work, this, workers.size());
+      job = _job;
+      num_active = num_helpers;
+      num_running = num_helpers;
+      round++;
+    }
+    start_cv.notify_all();
+    _job();
+    std::unique_lock<std::mutex> lock(mutex);
+    done_cv.wait(lock, [this]() { return num_running == 0; });
+  }
+};
+#endif
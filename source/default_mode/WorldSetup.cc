@@ -57,10 +57,20 @@ void SymWorld::Setup() {
   if (my_config->GRID() == 0) {SetPopStruct_Mixed(false);}
   else SetPopStruct_Grid(my_config->GRID_X(), my_config->GRID_Y(), false);
 
+  //the population arrays and organisms allocated from here on follow the memory policy
+  MemoryPolicy::Set(my_config->HUGE_PAGES(), my_config->NUMA_POLICY());
+
+  //without free-living symbionts the world has no use for a free-living layer
+  SetFreeLivingLayer(my_config->FREE_LIVING_SYMS());
+
   SetupHosts(&POP_SIZE);
 
   Resize(my_config->GRID_X(), my_config->GRID_Y());
   long unsigned int total_syms = POP_SIZE * start_moi;
   SetupSymbionts(&total_syms);
+
+  //threaded updates bind the neighbor functions once, here, and keep their worker threads
+  if (CanUpdateInParallel()) SetupTiles();
+  FreezeConfig();
 }
 #endif
@@ -12,15 +12,18 @@ protected:
     * Purpose: Represents the efficiency of a host.
     *
   */
-  double efficiency;
+  trait_t efficiency;
 
-  /**
-    *
-    * Purpose: Represents the world that the efficient hosts are living in.
-    *
-  */
-  emp::Ptr<EfficientWorld> my_world = NULL;
 public:
+  /**
+   * Input: None
+   *
+   * Output: The EfficientWorld the efficient host lives in.
+   *
+   * Purpose: To get the efficient host's world as a EfficientWorld.
+   */
+  emp::Ptr<EfficientWorld> GetWorld() {return Host::GetWorld().Cast<EfficientWorld>();}
+
   /**
    * The constructor for efficient host
    */
@@ -30,7 +33,6 @@ public:
   double _points = 0.0, double _efficient = 0.1) :
   Host(_random, _world, _config, _intval, _syms, _repro_syms, _points) {
     efficiency = _efficient;
-    my_world = _world;
   }
 
 
@@ -74,6 +76,17 @@ public:
     return  "EfficientHost";
   }
 
+  /**
+  * Input: None
+  *
+  * Output: The size in bytes of a EfficientHost object
+  *
+  * Purpose: To account for the memory organisms take up by their exact type
+  */
+  size_t GetObjectSize() {
+    return sizeof(EfficientHost);
+  }
+
   /**
    * Input: Efficiency value
    *
@@ -103,7 +116,7 @@ public:
    * Purpose: To avoid creating an organism via constructor in other methods.
    */
   emp::Ptr<Organism> MakeNew(){
-    emp::Ptr<EfficientHost> host_baby = emp::NewPtr<EfficientHost>(random, my_world, my_config, GetIntVal());
+    emp::Ptr<EfficientHost> host_baby = emp::NewPtr<EfficientHost>(context->random, GetWorld(), GetConfig(), GetIntVal());
     host_baby->SetEfficiency(GetEfficiency());
     return host_baby;
   }
@@ -16,7 +16,7 @@ protected:
     * symbiont's resource collection.
     *
   */
-  double efficiency;
+  trait_t efficiency;
 
   /**
     *
@@ -43,28 +43,30 @@ protected:
   */
   double eff_mut_rate = 0;
 
-  /**
-    *
-    * Purpose: Represents the world that the efficient symbionts are living in.
-    *
-  */
-  emp::Ptr<EfficientWorld> my_world = NULL;
 public:
+  /**
+   * Input: None
+   *
+   * Output: The EfficientWorld the efficient symbiont lives in.
+   *
+   * Purpose: To get the efficient symbiont's world as a EfficientWorld.
+   */
+  emp::Ptr<EfficientWorld> GetWorld() {return Symbiont::GetWorld().Cast<EfficientWorld>();}
+
   /**
    * The constructor for efficient symbiont
    */
   EfficientSymbiont(emp::Ptr<emp::Random> _random, emp::Ptr<EfficientWorld> _world, emp::Ptr<SymConfigBase> _config, double _intval=0.0, double _points = 0.0, double _efficient = 0.1) : Symbiont(_random, _world, _config, _intval, _points) {
     efficiency = _efficient;
-    my_world = _world;
-    if(my_config->HORIZ_MUTATION_RATE() < 0){
-      ht_mut_rate = my_config->MUTATION_RATE();
+    if(GetConfig()->HORIZ_MUTATION_RATE() < 0){
+      ht_mut_rate = GetConfig()->MUTATION_RATE();
     } else {
-      ht_mut_rate = my_config->HORIZ_MUTATION_RATE();
+      ht_mut_rate = GetConfig()->HORIZ_MUTATION_RATE();
     }
-    if(my_config->HORIZ_MUTATION_SIZE() < 0) {
-      ht_mut_size = my_config->MUTATION_SIZE();
+    if(GetConfig()->HORIZ_MUTATION_SIZE() < 0) {
+      ht_mut_size = GetConfig()->MUTATION_SIZE();
     } else {
-      ht_mut_size = my_config->HORIZ_MUTATION_SIZE();
+      ht_mut_size = GetConfig()->HORIZ_MUTATION_SIZE();
     }
   }
 
@@ -109,6 +111,17 @@ public:
     return  "EfficientSymbiont";
   }
 
+  /**
+  * Input: None
+  *
+  * Output: The size in bytes of a EfficientSymbiont object
+  *
+  * Purpose: To account for the memory organisms take up by their exact type
+  */
+  size_t GetObjectSize() {
+    return sizeof(EfficientSymbiont);
+  }
+
   /**
    * Input: Efficiency value
    *
@@ -158,8 +171,8 @@ public:
     double int_rate;
 
     if(mode == "vertical"){
-      local_rate = my_config->MUTATION_RATE();
-      local_size = my_config->MUTATION_SIZE();
+      local_rate = GetConfig()->MUTATION_RATE();
+      local_size = GetConfig()->MUTATION_SIZE();
     } else if(mode == "horizontal") {
       local_rate = ht_mut_rate;
       local_size = ht_mut_size;
@@ -167,32 +180,32 @@ public:
       throw "Illegal argument passed to mutate in EfficientSymbiont";
     }
 
-    if(my_config->EFFICIENCY_MUT_RATE() >= 0) {
-      eff_mut_rate = my_config->EFFICIENCY_MUT_RATE();
+    if(GetConfig()->EFFICIENCY_MUT_RATE() >= 0) {
+      eff_mut_rate = GetConfig()->EFFICIENCY_MUT_RATE();
     } else {
       eff_mut_rate = local_rate;
     }
 
-    if(my_config->INT_VAL_MUT_RATE() >= 0) {
-      int_rate = my_config->INT_VAL_MUT_RATE();
+    if(GetConfig()->INT_VAL_MUT_RATE() >= 0) {
+      int_rate = GetConfig()->INT_VAL_MUT_RATE();
     } else {
       int_rate = local_rate;
     }
 
-    if (random->GetDouble(0.0, 1.0) <= int_rate) {
-      interaction_val += random->GetRandNormal(0.0, local_size);
+    if (GetRandom().GetDouble(0.0, 1.0) <= int_rate) {
+      interaction_val += GetRandom().GetRandNormal(0.0, local_size);
       if(interaction_val < -1) interaction_val = -1;
       else if (interaction_val > 1) interaction_val = 1;
 
       //also modify infection chance, which is between 0 and 1
-      if(my_config->FREE_LIVING_SYMS()){
-        infection_chance += random->GetRandNormal(0.0, local_size);
+      if(GetConfig()->FREE_LIVING_SYMS()){
+        infection_chance += GetRandom().GetRandNormal(0.0, local_size);
         if (infection_chance < 0) infection_chance = 0;
         else if (infection_chance > 1) infection_chance = 1;
       }
     }
-    if (random->GetDouble(0.0, 1.0) <= eff_mut_rate) {
-      efficiency += random->GetRandNormal(0.0, local_size);
+    if (GetRandom().GetDouble(0.0, 1.0) <= eff_mut_rate) {
+      efficiency += GetRandom().GetRandNormal(0.0, local_size);
       if(efficiency < 0) efficiency = 0;
       else if (efficiency > 1) efficiency = 1;
     }
@@ -209,7 +222,7 @@ public:
    * Purpose: To avoid creating an organism via constructor in other methods.
    */
   emp::Ptr<Organism> MakeNew(){
-    emp::Ptr<EfficientSymbiont> sym_baby = emp::NewPtr<EfficientSymbiont>(random, my_world, my_config, GetIntVal());
+    emp::Ptr<EfficientSymbiont> sym_baby = emp::NewPtr<EfficientSymbiont>(context->random, GetWorld(), GetConfig(), GetIntVal());
     sym_baby->SetInfectionChance(GetInfectionChance());
     sym_baby->SetEfficiency(GetEfficiency());
     return sym_baby;
@@ -240,12 +253,13 @@ public:
    * Purpose: To allow for vertical transmission to occur
    */
   void VerticalTransmission(emp::Ptr<Organism> host_baby) {
-    if((my_world->WillTransmit()) && GetPoints() >= my_config->SYM_VERT_TRANS_RES()){ //if the world permits vertical tranmission and the sym has enough resources, transmit!
+    if((GetWorld()->WillTransmit()) && GetPoints() >= GetConfig()->SYM_VERT_TRANS_RES()){ //if the world permits vertical tranmission and the sym has enough resources, transmit!
       emp::Ptr<Organism> sym_baby = Reproduce("vertical");
       host_baby->AddSymbiont(sym_baby);
 
       //vertical transmission data node
-      emp::DataMonitor<int>& data_node_attempts_verttrans = my_world->GetVerticalTransmissionAttemptCount();
+      std::unique_lock<std::mutex> lock = GetWorld()->LockSharedState();
+      emp::DataMonitor<int>& data_node_attempts_verttrans = GetWorld()->GetVerticalTransmissionAttemptCount();
       data_node_attempts_verttrans.AddDatum(1);
     }
   }
@@ -258,19 +272,20 @@ public:
    * Purpose: To check and allow for horizontal transmission to occur
    */
   void HorizontalTransmission(emp::WorldPosition location) {
-    if (my_config->HORIZ_TRANS()) { //non-lytic horizontal transmission enabled
-      if(GetPoints() >= my_config->SYM_HORIZ_TRANS_RES()) {
+    if (GetConfig()->HORIZ_TRANS()) { //non-lytic horizontal transmission enabled
+      if(GetPoints() >= GetConfig()->SYM_HORIZ_TRANS_RES()) {
         // symbiont reproduces independently (horizontal transmission) if it has enough resources
         // new symbiont in this host with mutated value
         SetPoints(0); //TODO: test just subtracting points instead of setting to 0
         emp::Ptr<Organism> sym_baby = Reproduce("horizontal");
-        emp::WorldPosition new_pos = my_world->SymDoBirth(sym_baby, location);
+        emp::WorldPosition new_pos = GetWorld()->SymDoBirth(sym_baby, location);
 
         //horizontal transmission data nodes
-        emp::DataMonitor<int>& data_node_attempts_horiztrans = my_world->GetHorizontalTransmissionAttemptCount();
+        std::unique_lock<std::mutex> lock = GetWorld()->LockSharedState();
+        emp::DataMonitor<int>& data_node_attempts_horiztrans = GetWorld()->GetHorizontalTransmissionAttemptCount();
         data_node_attempts_horiztrans.AddDatum(1);
 
-        emp::DataMonitor<int>& data_node_successes_horiztrans = my_world->GetHorizontalTransmissionSuccessCount();
+        emp::DataMonitor<int>& data_node_successes_horiztrans = GetWorld()->GetHorizontalTransmissionSuccessCount();
         if(new_pos.IsValid()){
           data_node_successes_horiztrans.AddDatum(1);
         }
@@ -48,6 +48,18 @@ public:
     SetupEfficiencyFile(my_config->FILE_PATH()+"Efficiency"+my_config->FILE_NAME()+file_ending).SetTimingRepeat(my_config->DATA_INT());
   }
 
+  /**
+   * Input: The report to add to.
+   *
+   * Output: None.
+   *
+   * Purpose: To account for the efficiency data monitors along with the default ones.
+   */
+  void AddDataMonitorsTo(MemoryReport & report){
+    SymWorld::AddDataMonitorsTo(report);
+    AddMonitorTo(report, data_node_efficiency);
+  }
+
   /**
    * Input: The address of the string representing the file to be
    * created's name
@@ -57,10 +69,10 @@ public:
    * Purpose: To set up the file that will be used to track mean efficiency
    */
   emp::DataFile & SetupEfficiencyFile(const std::string & filename) {
-    auto & file = SetupFile(filename);
+    auto & file = SetupStatsFile(filename);
     auto & node = GetEfficiencyDataNode();
     file.AddVar(update, "update", "Update");
-    file.AddMean(node, "mean_efficiency", "Average efficiency", true);
+    AddStatsMean(file, node, "mean_efficiency", "Average efficiency", true);
     file.PrintHeaderKeys();
 
     return file;
@@ -78,21 +90,9 @@ public:
   emp::DataMonitor<double>& GetEfficiencyDataNode() {
     if (!data_node_efficiency) {
       data_node_efficiency.New();
-      OnUpdate([this](size_t){
-        data_node_efficiency->Reset();
-        for (size_t i = 0; i< pop.size(); i++) {
-          if (IsOccupied(i)) {
-            emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
-            size_t sym_size = syms.size();
-            for(size_t j=0; j< sym_size; j++){
-              data_node_efficiency->AddDatum(syms[j]->GetEfficiency());
-            }//close for
-          }//close if
-          if(sym_pop[i]) {
-            data_node_efficiency->AddDatum(sym_pop[i]->GetEfficiency());
-          }//close if
-      }//close for
-      });
+      AddStatsCollector(data_node_efficiency, nullptr,
+        [](emp::Ptr<Organism>, emp::Ptr<Organism> sym){return sym->GetEfficiency();},
+        [](emp::Ptr<Organism> sym){return sym->GetEfficiency();});
     }
     return *data_node_efficiency;
   }
@@ -17,16 +17,17 @@ protected:
     *
     *
   */
-  double host_incorporation_val = 0;
-
-  /**
-    *
-    * Purpose: Represents the world that the hosts are living in.
-    *
-  */
-  emp::Ptr<LysisWorld> my_world = NULL;
+  trait_t host_incorporation_val = 0;
 
 public:
+  /**
+   * Input: None
+   *
+   * Output: The LysisWorld the bacterium lives in.
+   *
+   * Purpose: To get the bacterium's world as a LysisWorld.
+   */
+  emp::Ptr<LysisWorld> GetWorld() {return Host::GetWorld().Cast<LysisWorld>();}
 
   /**
    * The constructor for the bacterium class
@@ -35,11 +36,10 @@ public:
   double _intval =0.0, emp::vector<emp::Ptr<Organism>> _syms = {},
   emp::vector<emp::Ptr<Organism>> _repro_syms = {},
   double _points = 0.0) : Host(_random, _world, _config, _intval,_syms, _repro_syms, _points)  {
-    host_incorporation_val = my_config->HOST_INC_VAL();
+    host_incorporation_val = GetConfig()->HOST_INC_VAL();
     if(host_incorporation_val == -1){
-      host_incorporation_val = random->GetDouble(0.0, 1.0);
+      host_incorporation_val = GetRandom().GetDouble(0.0, 1.0);
     }
-    my_world = _world;
   }
 
   /**
@@ -82,6 +82,17 @@ public:
     return  "Bacterium";
   }
 
+  /**
+  * Input: None
+  *
+  * Output: The size in bytes of a Bacterium object
+  *
+  * Purpose: To account for the memory organisms take up by their exact type
+  */
+  size_t GetObjectSize() {
+    return sizeof(Bacterium);
+  }
+
   /**
    * Input: None
    *
@@ -109,7 +120,7 @@ public:
    * Purpose: To avoid creating an organism via constructor in other methods.
    */
   emp::Ptr<Organism> MakeNew(){
-    emp::Ptr<Bacterium> host_baby = emp::NewPtr<Bacterium>(random, my_world, my_config, GetIntVal());
+    emp::Ptr<Bacterium> host_baby = emp::NewPtr<Bacterium>(context->random, GetWorld(), GetConfig(), GetIntVal());
     host_baby->SetIncVal(GetIncVal());
     return host_baby;
   }
@@ -126,11 +137,11 @@ public:
   void Mutate() {
     Host::Mutate();
 
-    if(random->GetDouble(0.0, 1.0) <= my_config->MUTATION_RATE()){
+    if(GetRandom().GetDouble(0.0, 1.0) <= GetConfig()->MUTATION_RATE()){
 
       //mutate host genome if enabled
-      if(my_config->MUTATE_INC_VAL()){
-        host_incorporation_val += random->GetRandNormal(0.0, my_config->MUTATION_SIZE());
+      if(GetConfig()->MUTATE_INC_VAL()){
+        host_incorporation_val += GetRandom().GetRandNormal(0.0, GetConfig()->MUTATION_SIZE());
 
         if(host_incorporation_val < 0) host_incorporation_val = 0;
 
@@ -141,7 +152,7 @@ public:
 
   double ProcessLysogenResources(double phage_inc_val){
     double incorporation_success = 1 - abs(GetIncVal() - phage_inc_val);
-    double processed_resources = GetResInProcess() * incorporation_success * my_config->SYNERGY();
+    double processed_resources = GetResInProcess() * incorporation_success * GetConfig()->SYNERGY();
     SetResInProcess(0);
     return processed_resources;
   }
@@ -60,6 +60,23 @@ public:
     SetupIncorporationDifferenceFile(my_config->FILE_PATH()+"IncValDifferences"+my_config->FILE_NAME()+file_ending).SetTimingRepeat(my_config->DATA_INT());
   }
 
+  /**
+   * Input: The report to add to.
+   *
+   * Output: None.
+   *
+   * Purpose: To account for the lysis data monitors along with the default ones.
+   */
+  void AddDataMonitorsTo(MemoryReport & report){
+    SymWorld::AddDataMonitorsTo(report);
+    AddHistogramMonitorTo(report, data_node_lysischance);
+    AddHistogramMonitorTo(report, data_node_inductionchance);
+    AddHistogramMonitorTo(report, data_node_incorporation_difference);
+    AddMonitorTo(report, data_node_burst_size);
+    AddMonitorTo(report, data_node_burst_count);
+    AddMonitorTo(report, data_node_cfu);
+  }
+
   /**
    * Input: The Empirical DataFile object tracking data nodes.
    *
@@ -84,7 +101,7 @@ public:
    * the mean lysis chance.
    */
   emp::DataFile & SetupLysisChanceFile(const std::string & filename) {
-    auto & file = SetupFile(filename);
+    auto & file = SetupStatsFile(filename);
     auto & node1 = GetSymCountDataNode();
     auto & node = GetLysisChanceDataNode();
     auto & node2 = GetBurstSizeDataNode();
@@ -93,17 +110,17 @@ public:
     file.AddTotal(node1, "count", "Total number of symbionts");
     file.AddMean(node2, "mean_burstsize", "Average burst size", true);
     file.AddTotal(node3, "burst_count", "Average burst count", true);
-    file.AddMean(node, "mean_lysischance", "Average chance of lysis");
-    file.AddHistBin(node, 0, "Hist_0.0", "Count for histogram bin 0.0 to <0.1");
-    file.AddHistBin(node, 1, "Hist_0.1", "Count for histogram bin 0.1 to <0.2");
-    file.AddHistBin(node, 2, "Hist_0.2", "Count for histogram bin 0.2 to <0.3");
-    file.AddHistBin(node, 3, "Hist_0.3", "Count for histogram bin 0.3 to <0.4");
-    file.AddHistBin(node, 4, "Hist_0.4", "Count for histogram bin 0.4 to <0.5");
-    file.AddHistBin(node, 5, "Hist_0.5", "Count for histogram bin 0.5 to <0.6");
-    file.AddHistBin(node, 6, "Hist_0.6", "Count for histogram bin 0.6 to <0.7");
-    file.AddHistBin(node, 7, "Hist_0.7", "Count for histogram bin 0.7 to <0.8");
-    file.AddHistBin(node, 8, "Hist_0.8", "Count for histogram bin 0.8 to <0.9");
-    file.AddHistBin(node, 9, "Hist_0.9", "Count for histogram bin 0.9 to 1.0");
+    AddStatsMean(file, node, "mean_lysischance", "Average chance of lysis");
+    AddStatsHistBin(file, node, 0, "Hist_0.0", "Count for histogram bin 0.0 to <0.1");
+    AddStatsHistBin(file, node, 1, "Hist_0.1", "Count for histogram bin 0.1 to <0.2");
+    AddStatsHistBin(file, node, 2, "Hist_0.2", "Count for histogram bin 0.2 to <0.3");
+    AddStatsHistBin(file, node, 3, "Hist_0.3", "Count for histogram bin 0.3 to <0.4");
+    AddStatsHistBin(file, node, 4, "Hist_0.4", "Count for histogram bin 0.4 to <0.5");
+    AddStatsHistBin(file, node, 5, "Hist_0.5", "Count for histogram bin 0.5 to <0.6");
+    AddStatsHistBin(file, node, 6, "Hist_0.6", "Count for histogram bin 0.6 to <0.7");
+    AddStatsHistBin(file, node, 7, "Hist_0.7", "Count for histogram bin 0.7 to <0.8");
+    AddStatsHistBin(file, node, 8, "Hist_0.8", "Count for histogram bin 0.8 to <0.9");
+    AddStatsHistBin(file, node, 9, "Hist_0.9", "Count for histogram bin 0.9 to 1.0");
 
     file.PrintHeaderKeys();
 
@@ -121,22 +138,22 @@ public:
     * the mean induction chance.
     */
   emp::DataFile & SetupInductionChanceFile(const std::string & filename) {
-     auto & file = SetupFile(filename);
+     auto & file = SetupStatsFile(filename);
      auto & node1 = GetSymCountDataNode();
      auto & node = GetInductionChanceDataNode();
      file.AddVar(update, "update", "Update");
-     file.AddMean(node, "mean_inductionchance", "Average chance of induction");
+     AddStatsMean(file, node, "mean_inductionchance", "Average chance of induction");
      file.AddTotal(node1, "count", "Total number of symbionts");
-     file.AddHistBin(node, 0, "Hist_0.0", "Count for histogram bin 0.0 to <0.1");
-     file.AddHistBin(node, 1, "Hist_0.1", "Count for histogram bin 0.1 to <0.2");
-     file.AddHistBin(node, 2, "Hist_0.2", "Count for histogram bin 0.2 to <0.3");
-     file.AddHistBin(node, 3, "Hist_0.3", "Count for histogram bin 0.3 to <0.4");
-     file.AddHistBin(node, 4, "Hist_0.4", "Count for histogram bin 0.4 to <0.5");
-     file.AddHistBin(node, 5, "Hist_0.5", "Count for histogram bin 0.5 to <0.6");
-     file.AddHistBin(node, 6, "Hist_0.6", "Count for histogram bin 0.6 to <0.7");
-     file.AddHistBin(node, 7, "Hist_0.7", "Count for histogram bin 0.7 to <0.8");
-     file.AddHistBin(node, 8, "Hist_0.8", "Count for histogram bin 0.8 to <0.9");
-     file.AddHistBin(node, 9, "Hist_0.9", "Count for histogram bin 0.9 to 1.0");
+     AddStatsHistBin(file, node, 0, "Hist_0.0", "Count for histogram bin 0.0 to <0.1");
+     AddStatsHistBin(file, node, 1, "Hist_0.1", "Count for histogram bin 0.1 to <0.2");
+     AddStatsHistBin(file, node, 2, "Hist_0.2", "Count for histogram bin 0.2 to <0.3");
+     AddStatsHistBin(file, node, 3, "Hist_0.3", "Count for histogram bin 0.3 to <0.4");
+     AddStatsHistBin(file, node, 4, "Hist_0.4", "Count for histogram bin 0.4 to <0.5");
+     AddStatsHistBin(file, node, 5, "Hist_0.5", "Count for histogram bin 0.5 to <0.6");
+     AddStatsHistBin(file, node, 6, "Hist_0.6", "Count for histogram bin 0.6 to <0.7");
+     AddStatsHistBin(file, node, 7, "Hist_0.7", "Count for histogram bin 0.7 to <0.8");
+     AddStatsHistBin(file, node, 8, "Hist_0.8", "Count for histogram bin 0.8 to <0.9");
+     AddStatsHistBin(file, node, 9, "Hist_0.9", "Count for histogram bin 0.9 to 1.0");
 
      file.PrintHeaderKeys();
 
@@ -154,20 +171,20 @@ public:
     * the incorporation vals.
     */
      emp::DataFile & SetupIncorporationDifferenceFile(const std::string & filename) {
-     auto & file = SetupFile(filename);
+     auto & file = SetupStatsFile(filename);
      auto & node = GetIncorporationDifferenceDataNode();
      file.AddVar(update, "update", "Update");
-     file.AddMean(node, "mean_incval_difference", "Average difference in incorporation value between bacteria and their phage");
-     file.AddHistBin(node, 0, "Hist_0.0", "Count for histogram bin 0.0 to <0.1");
-     file.AddHistBin(node, 1, "Hist_0.1", "Count for histogram bin 0.1 to <0.2");
-     file.AddHistBin(node, 2, "Hist_0.2", "Count for histogram bin 0.2 to <0.3");
-     file.AddHistBin(node, 3, "Hist_0.3", "Count for histogram bin 0.3 to <0.4");
-     file.AddHistBin(node, 4, "Hist_0.4", "Count for histogram bin 0.4 to <0.5");
-     file.AddHistBin(node, 5, "Hist_0.5", "Count for histogram bin 0.5 to <0.6");
-     file.AddHistBin(node, 6, "Hist_0.6", "Count for histogram bin 0.6 to <0.7");
-     file.AddHistBin(node, 7, "Hist_0.7", "Count for histogram bin 0.7 to <0.8");
-     file.AddHistBin(node, 8, "Hist_0.8", "Count for histogram bin 0.8 to <0.9");
-     file.AddHistBin(node, 9, "Hist_0.9", "Count for histogram bin 0.9 to 1.0");
+     AddStatsMean(file, node, "mean_incval_difference", "Average difference in incorporation value between bacteria and their phage");
+     AddStatsHistBin(file, node, 0, "Hist_0.0", "Count for histogram bin 0.0 to <0.1");
+     AddStatsHistBin(file, node, 1, "Hist_0.1", "Count for histogram bin 0.1 to <0.2");
+     AddStatsHistBin(file, node, 2, "Hist_0.2", "Count for histogram bin 0.2 to <0.3");
+     AddStatsHistBin(file, node, 3, "Hist_0.3", "Count for histogram bin 0.3 to <0.4");
+     AddStatsHistBin(file, node, 4, "Hist_0.4", "Count for histogram bin 0.4 to <0.5");
+     AddStatsHistBin(file, node, 5, "Hist_0.5", "Count for histogram bin 0.5 to <0.6");
+     AddStatsHistBin(file, node, 6, "Hist_0.6", "Count for histogram bin 0.6 to <0.7");
+     AddStatsHistBin(file, node, 7, "Hist_0.7", "Count for histogram bin 0.7 to <0.8");
+     AddStatsHistBin(file, node, 8, "Hist_0.8", "Count for histogram bin 0.8 to <0.9");
+     AddStatsHistBin(file, node, 9, "Hist_0.9", "Count for histogram bin 0.9 to 1.0");
 
      file.PrintHeaderKeys();
 
@@ -187,21 +204,9 @@ public:
   emp::DataMonitor<double,emp::data::Histogram>& GetLysisChanceDataNode() {
     if (!data_node_lysischance) {
       data_node_lysischance.New();
-      OnUpdate([this](size_t){
-        data_node_lysischance->Reset();
-        for (size_t i = 0; i< pop.size(); i++) {
-          if (IsOccupied(i)) {
-            emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
-            long unsigned int sym_size = syms.size();
-            for(size_t j=0; j< sym_size; j++){
-              data_node_lysischance->AddDatum(syms[j]->GetLysisChance());
-            }//close for
-          }//close if
-          if (sym_pop[i]){
-            data_node_lysischance->AddDatum(sym_pop[i]->GetLysisChance());
-          }
-        }//close for
-      });
+      AddStatsCollector(data_node_lysischance, nullptr,
+        [](emp::Ptr<Organism>, emp::Ptr<Organism> sym){return sym->GetLysisChance();},
+        [](emp::Ptr<Organism> sym){return sym->GetLysisChance();});
     }
     data_node_lysischance->SetupBins(0, 1.1, 11);
     return *data_node_lysischance;
@@ -252,21 +257,9 @@ public:
   emp::DataMonitor<double,emp::data::Histogram>& GetInductionChanceDataNode() {
     if (!data_node_inductionchance) {
       data_node_inductionchance.New();
-      OnUpdate([this](size_t){
-        data_node_inductionchance->Reset();
-        for (size_t i = 0; i< pop.size(); i++) {
-          if (IsOccupied(i)) {
-            emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
-            long unsigned int sym_size = syms.size();
-            for(size_t j=0; j< sym_size; j++){
-              data_node_inductionchance->AddDatum(syms[j]->GetInductionChance());
-            }//close for
-          }//close if
-          if (sym_pop[i]){
-            data_node_inductionchance->AddDatum(sym_pop[i]->GetInductionChance());
-          }
-        }//close for
-      });
+      AddStatsCollector(data_node_inductionchance, nullptr,
+        [](emp::Ptr<Organism>, emp::Ptr<Organism> sym){return sym->GetInductionChance();},
+        [](emp::Ptr<Organism> sym){return sym->GetInductionChance();});
     }
     data_node_inductionchance->SetupBins(0, 1.1, 11);
     return *data_node_inductionchance;
@@ -284,21 +277,11 @@ public:
   emp::DataMonitor<double,emp::data::Histogram>& GetIncorporationDifferenceDataNode() {
     if (!data_node_incorporation_difference) {
       data_node_incorporation_difference.New();
-      OnUpdate([this](size_t){
-        data_node_incorporation_difference->Reset();
-        for (size_t i = 0; i< pop.size(); i++) {
-          if (IsOccupied(i)) {
-            double host_inc_val = pop[i]->GetIncVal();
-
-            emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
-            long unsigned int sym_size = syms.size();
-            for(size_t j=0; j< sym_size; j++){
-              double inc_val_difference = abs(host_inc_val - syms[j]->GetIncVal());
-              data_node_incorporation_difference->AddDatum(inc_val_difference);
-            }
-          }//close if
-        }//close for
-      });
+      AddStatsCollector(data_node_incorporation_difference, nullptr,
+        [](emp::Ptr<Organism> host, emp::Ptr<Organism> sym){
+          double inc_val_difference = abs(host->GetIncVal() - sym->GetIncVal());
+          return inc_val_difference;
+        });
     }
     data_node_incorporation_difference->SetupBins(0, 1.1, 11);
     return *data_node_incorporation_difference;
@@ -317,32 +300,11 @@ public:
     //keep track of host organisms that are uninfected or infected with only lysogenic phage
     if(!data_node_cfu) {
       data_node_cfu.New();
-      OnUpdate([this](size_t){
-        data_node_cfu -> Reset();
-
-        for (size_t i = 0; i < pop.size(); i++) {
-          if(IsOccupied(i)) {
-            //uninfected hosts
-            if((pop[i]->GetSymbionts()).empty()) {
-              data_node_cfu->AddDatum(1);
-            }
-
-            //infected hosts, check if all symbionts are lysogenic
-            if(pop[i]->HasSym()) {
-              emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
-              bool all_lysogenic = true;
-              for(long unsigned int j = 0; j < syms.size(); j++){
-                if(syms[j]->IsPhage() && syms[j]->GetLysogeny() == false){
-                  all_lysogenic = false;
-                }
-              }
-              if(all_lysogenic){
-                data_node_cfu->AddDatum(1);
-              }
-            }
-          } //endif
-        } //end for
-      }); //end OnUpdate
+      //hosts that are uninfected or whose phage are all lysogenic
+      AddStatsCollector({[this](){
+        data_node_cfu->Reset();
+        data_node_cfu->AddDatum(GetNumHosts() - GetNumLyticHosts());
+      }});
     } //end if
     return *data_node_cfu;
   }
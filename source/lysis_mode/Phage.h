@@ -25,48 +25,48 @@ protected:
     * Purpose: Represents the compatibility of the prophage to it's placement within the host's genome.
     *
   */
-  double incorporation_val = 0.0;
+  trait_t incorporation_val = 0.0;
 
   /**
     *
     * Purpose: Represents the chance of lysis
     *
   */
-  double chance_of_lysis = 1;
+  trait_t chance_of_lysis = 1;
 
   /**
     *
     * Purpose: Represents the chance of a prophage inducing to the lytic process
     *
   */
-  double induction_chance = 1;
+  trait_t induction_chance = 1;
 
+public:
   /**
-    *
-    * Purpose: Represents the world that the phage are living in.
-    *
-  */
-  emp::Ptr<LysisWorld> my_world = NULL;
-
+   * Input: None
+   *
+   * Output: The LysisWorld the phage lives in.
+   *
+   * Purpose: To get the phage's world as a LysisWorld.
+   */
+  emp::Ptr<LysisWorld> GetWorld() {return Symbiont::GetWorld().Cast<LysisWorld>();}
 
-public:
   /**
    * The constructor for phage
    */
   Phage(emp::Ptr<emp::Random> _random, emp::Ptr<LysisWorld> _world, emp::Ptr<SymConfigBase> _config, double _intval=0.0, double _points = 0.0) : Symbiont(_random, _world, _config, _intval, _points) {
-    chance_of_lysis = my_config->LYSIS_CHANCE();
-    induction_chance = my_config->CHANCE_OF_INDUCTION();
-    incorporation_val = my_config->PHAGE_INC_VAL();
+    chance_of_lysis = GetConfig()->LYSIS_CHANCE();
+    induction_chance = GetConfig()->CHANCE_OF_INDUCTION();
+    incorporation_val = GetConfig()->PHAGE_INC_VAL();
     if(chance_of_lysis == -1){
-      chance_of_lysis = random->GetDouble(0.0, 1.0);
+      chance_of_lysis = GetRandom().GetDouble(0.0, 1.0);
     }
     if(induction_chance == -1){
-      induction_chance = random->GetDouble(0.0, 1.0);
+      induction_chance = GetRandom().GetDouble(0.0, 1.0);
     }
     if(incorporation_val == -1){
-      incorporation_val = random->GetDouble(0.0, 1.0);
+      incorporation_val = GetRandom().GetDouble(0.0, 1.0);
     }
-    my_world = _world;
   }
 
 
@@ -110,6 +110,17 @@ public:
     return  "Phage";
   }
 
+  /**
+  * Input: None
+  *
+  * Output: The size in bytes of a Phage object
+  *
+  * Purpose: To account for the memory organisms take up by their exact type
+  */
+  size_t GetObjectSize() {
+    return sizeof(Phage);
+  }
+
   /**Input: None
    *
    * Output: The double representing the phage's burst timer.
@@ -126,7 +137,7 @@ public:
    *
    * Purpose: To increment a phage's burst timer.
    */
-  void IncBurstTimer() {burst_timer += random->GetRandNormal(1.0, 1.0);}
+  void IncBurstTimer() {burst_timer += GetRandom().GetRandNormal(1.0, 1.0);}
 
 
   /**
@@ -204,6 +215,22 @@ public:
    */
   bool GetLysogeny() {return lysogeny;}
 
+  /**
+   * Input: The bool representing if the phage is lysogenic.
+   *
+   * Output: None
+   *
+   * Purpose: To set whether a phage is lysogenic, as when it is induced.
+   * A switch is counted if the phage's host is in the world.
+   */
+  void SetLysogeny(bool _in) {
+    emp::Ptr<Organism> host = GetHost();
+    bool counted = _in != lysogeny && host && host->IsInWorld();
+    if (counted) GetWorld()->CountHost(host, -1);
+    lysogeny = _in;
+    if (counted) GetWorld()->CountHost(host, 1);
+  }
+
 
   /**
    * Input: None
@@ -226,7 +253,7 @@ public:
    * them being neutral.
    */
   void UponInjection() {
-    double rand_chance = random->GetDouble(0.0, 1.0);
+    double rand_chance = GetRandom().GetDouble(0.0, 1.0);
     if (rand_chance <= chance_of_lysis){
       lysogeny = false;
     } else {
@@ -247,22 +274,22 @@ public:
    */
   void Mutate() {
     Symbiont::Mutate();
-    double local_rate = my_config->MUTATION_RATE();
-    double local_size = my_config->MUTATION_SIZE();
-    if (random->GetDouble(0.0, 1.0) <= local_rate) {
+    double local_rate = GetConfig()->MUTATION_RATE();
+    double local_size = GetConfig()->MUTATION_SIZE();
+    if (GetRandom().GetDouble(0.0, 1.0) <= local_rate) {
       //mutate chance of lysis/lysogeny, if enabled
-      if(my_config->MUTATE_LYSIS_CHANCE()){
-        chance_of_lysis += random->GetRandNormal(0.0, local_size);
+      if(GetConfig()->MUTATE_LYSIS_CHANCE()){
+        chance_of_lysis += GetRandom().GetRandNormal(0.0, local_size);
         if(chance_of_lysis < 0) chance_of_lysis = 0;
         else if (chance_of_lysis > 1) chance_of_lysis = 1;
       }
-      if(my_config->MUTATE_INDUCTION_CHANCE()){
-        induction_chance += random->GetRandNormal(0.0, local_size);
+      if(GetConfig()->MUTATE_INDUCTION_CHANCE()){
+        induction_chance += GetRandom().GetRandNormal(0.0, local_size);
         if(induction_chance < 0) induction_chance = 0;
         else if (induction_chance > 1) induction_chance = 1;
       }
-      if(my_config->MUTATE_INC_VAL()){
-        incorporation_val += random->GetRandNormal(0.0, local_size);
+      if(GetConfig()->MUTATE_INC_VAL()){
+        incorporation_val += GetRandom().GetRandNormal(0.0, local_size);
         if(incorporation_val < 0) incorporation_val = 0;
         else if (incorporation_val > 1) incorporation_val = 1;
       }
@@ -277,7 +304,7 @@ public:
    * Purpose: To produce a new symbiont, identical to the original
    */
   emp::Ptr<Organism> MakeNew() {
-    emp::Ptr<Phage> sym_baby = emp::NewPtr<Phage>(random, my_world, my_config, GetIntVal());
+    emp::Ptr<Phage> sym_baby = emp::NewPtr<Phage>(context->random, GetWorld(), GetConfig(), GetIntVal());
     // pass down parent's genome
     sym_baby->SetIncVal(GetIncVal());
     sym_baby->SetLysisChance(GetLysisChance());
@@ -294,21 +321,28 @@ public:
    * Purpose: To burst host and release offspring
    */
   void LysisBurst(emp::WorldPosition location){
-    emp::vector<emp::Ptr<Organism>>& repro_syms = my_host->GetReproSymbionts();
+    SymbiontList& repro_syms = my_host->GetReproSymbionts();
+    size_t num_successes = 0;
+    for(size_t r=0; r<repro_syms.size(); r++) {
+      emp::WorldPosition new_pos = GetWorld()->SymDoBirth(repro_syms[r], location);
+      if(new_pos.IsValid()){
+        num_successes++;
+      }
+    }
+
+    std::unique_lock<std::mutex> lock = GetWorld()->LockSharedState();
     //Record the burst size and count
-    emp::DataMonitor<double>& data_node_burst_size = my_world->GetBurstSizeDataNode();
+    emp::DataMonitor<double>& data_node_burst_size = GetWorld()->GetBurstSizeDataNode();
     data_node_burst_size.AddDatum(repro_syms.size());
-    emp::DataMonitor<int>& data_node_burst_count = my_world->GetBurstCountDataNode();
+    emp::DataMonitor<int>& data_node_burst_count = GetWorld()->GetBurstCountDataNode();
     data_node_burst_count.AddDatum(1);
-    emp::DataMonitor<int>& data_node_attempts_horiztrans = my_world->GetHorizontalTransmissionAttemptCount();
-    emp::DataMonitor<int>& data_node_successes_horiztrans = my_world->GetHorizontalTransmissionSuccessCount();
 
+    //horizontal transmission data nodes
+    emp::DataMonitor<int>& data_node_attempts_horiztrans = GetWorld()->GetHorizontalTransmissionAttemptCount();
+    emp::DataMonitor<int>& data_node_successes_horiztrans = GetWorld()->GetHorizontalTransmissionSuccessCount();
     for(size_t r=0; r<repro_syms.size(); r++) {
-      emp::WorldPosition new_pos = my_world->SymDoBirth(repro_syms[r], location);
-
-      //horizontal transmission data nodes
       data_node_attempts_horiztrans.AddDatum(1);
-      if(new_pos.IsValid()){
+      if(r < num_successes){
         data_node_successes_horiztrans.AddDatum(1);
       }
     }
@@ -326,15 +360,15 @@ public:
    */
   void LysisStep(){
     IncBurstTimer();
-    if(my_config->SYM_LYSIS_RES() == 0) {
+    if(GetConfig()->SYM_LYSIS_RES() == 0) {
       std::cout << "Lysis with a sym_lysis_res of 0 leads to an \
       infinite loop, please change" << std::endl;
       std::exit(1);
     }
-    while(GetPoints() >= my_config->SYM_LYSIS_RES()) {
+    while(GetPoints() >= GetConfig()->SYM_LYSIS_RES()) {
       emp::Ptr<Organism> sym_baby = Reproduce();
       my_host->AddReproSym(sym_baby);
-      SetPoints(GetPoints() - my_config->SYM_LYSIS_RES());
+      SetPoints(GetPoints() - GetConfig()->SYM_LYSIS_RES());
     }
   }
 
@@ -354,7 +388,8 @@ public:
       host_baby->AddSymbiont(phage_baby);
 
       //vertical transmission data node
-      emp::DataMonitor<int>& data_node_attempts_verttrans = my_world->GetVerticalTransmissionAttemptCount();
+      std::unique_lock<std::mutex> lock = GetWorld()->LockSharedState();
+      emp::DataMonitor<int>& data_node_attempts_verttrans = GetWorld()->GetVerticalTransmissionAttemptCount();
       data_node_attempts_verttrans.AddDatum(1);
     }
   }
@@ -375,7 +410,7 @@ public:
       host = my_host;
     }
     if(lysogeny){
-      if(my_config->BENEFIT_TO_HOST()){
+      if(GetConfig()->BENEFIT_TO_HOST()){
         return host->ProcessLysogenResources(incorporation_val);
       } else{
         return 0;
@@ -393,10 +428,21 @@ public:
    *
    * Purpose: To process a phage, meaning check for reproduction, check for lysis, and move the phage.
    */
-  void Process(emp::WorldPosition location) {
-    if(my_config->LYSIS() && !GetHost().IsNull()) { //lysis enabled and phage is in a host
+  void Process(emp::WorldPosition location) {ProcessWith(location, LiveParams(*GetConfig()));}
+
+  /**
+   * Input: The location of the phage, and the settings to process it with.
+   *
+   * Output: None
+   *
+   * Purpose: To process the phage as Process() does, with the settings read
+   * from a snapshot when the world has frozen them.
+   */
+  template <typename PARAMS>
+  void ProcessWith(emp::WorldPosition location, const PARAMS & params) {
+    if(params.Lysis() && !GetHost().IsNull()) { //lysis enabled and phage is in a host
       if(!lysogeny){ //phage has chosen lysis
-        if(GetBurstTimer() >= my_config->BURST_TIME() ) { //time to lyse!
+        if(GetBurstTimer() >= GetConfig()->BURST_TIME() ) { //time to lyse!
           LysisBurst(location);
         }
         else { //not time to lyse
@@ -404,18 +450,18 @@ public:
         }
       }
       else if(lysogeny){ //phage has chosen lysogeny
-        double rand_chance = random->GetDouble(0.0, 1.0);
+        double rand_chance = GetRandom().GetDouble(0.0, 1.0);
         if (rand_chance <= induction_chance){//phage has chosen to induce and turn lytic
-          lysogeny = false;
+          SetLysogeny(false);
         }
-        else if(random->GetDouble(0.0, 1.0) <= my_config->PROPHAGE_LOSS_RATE()){ //check if the phage's host should become susceptible again
+        else if(GetRandom().GetDouble(0.0, 1.0) <= GetConfig()->PROPHAGE_LOSS_RATE()){ //check if the phage's host should become susceptible again
           SetDead();
         }
       }
     }
 
-    else if (GetHost().IsNull() && my_config->FREE_LIVING_SYMS()) { //phage is free living
-      my_world->MoveFreeSym(location);
+    else if (params.FreeLivingSyms() && GetHost().IsNull()) { //phage is free living
+      GetWorld()->MoveFreeSym(location);
     }
   }
 };
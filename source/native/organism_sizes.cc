@@ -0,0 +1,42 @@
+#include "../default_mode/SymWorld.h"
+#include "../default_mode/WorldSetup.cc"
+#include "../lysis_mode/LysisWorld.h"
+#include "../lysis_mode/LysisWorldSetup.cc"
+#include "../efficient_mode/EfficientWorld.h"
+#include "../efficient_mode/EfficientWorldSetup.cc"
+#include "../pgg_mode/PGGWorld.h"
+#include "../pgg_mode/PGGWorldSetup.cc"
+#include <iomanip>
+#include <iostream>
+
+/**
+ * Input: The name of an organism type.
+ *
+ * Output: None
+ *
+ * Purpose: To print how many bytes one organism of the type takes up, both on
+ * its own and in the organism pool's size classes (what a live one costs).
+ */
+template <typename ORG>
+void PrintOrganismSize(const std::string & name) {
+  size_t pooled = ((sizeof(ORG) - 1) / OrganismPool::SLOT_ALIGN + 1) * OrganismPool::SLOT_ALIGN;
+  std::cout << std::left << std::setw(20) << name
+            << std::right << std::setw(8) << sizeof(ORG)
+            << std::setw(8) << pooled << std::endl;
+}
+
+// Reports the size of every organism type, for checking the memory footprint
+// of a change to the organism classes.
+int main()
+{
+  std::cout << std::left << std::setw(20) << "organism"
+            << std::right << std::setw(8) << "bytes" << std::setw(8) << "pooled" << std::endl;
+  PrintOrganismSize<Host>("Host");
+  PrintOrganismSize<Symbiont>("Symbiont");
+  PrintOrganismSize<Bacterium>("Bacterium");
+  PrintOrganismSize<Phage>("Phage");
+  PrintOrganismSize<EfficientHost>("EfficientHost");
+  PrintOrganismSize<EfficientSymbiont>("EfficientSymbiont");
+  PrintOrganismSize<PGGHost>("PGGHost");
+  PrintOrganismSize<PGGSymbiont>("PGGSymbiont");
+}
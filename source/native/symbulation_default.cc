@@ -1,6 +1,11 @@
 #include "../default_mode/SymWorld.h"
 #include "../default_mode/WorldSetup.cc"
 #include "../default_mode/DataNodes.h"
+#include "../default_mode/MeanFieldWorld.h"
+#include "../default_mode/ArrayWorld.h"
+#include "../default_mode/GenotypeCountWorld.h"
+#include "../default_mode/SymWorldT.h"
+#include "../default_mode/Ensemble.h"
 #include "symbulation.h"
 
 // This is the main function for the NATIVE version of this project.
@@ -12,7 +17,50 @@ int symbulation_main(int argc, char * argv[])
   config.Write(std::cout);
   emp::Random random(config.SEED());
 
-  SymWorld world(random, &config);
+  if(config.MEAN_FIELD() == 1){
+    if(config.GRID() == 1 || config.FREE_LIVING_SYMS() == 1){
+      std::cerr << "The mean-field engine only models well-mixed worlds without free-living symbionts (GRID 0, FREE_LIVING_SYMS 0)." << std::endl;
+      exit(1);
+    }
+    MeanFieldWorld world(random, &config);
+    world.Setup();
+    world.CreateDataFiles();
+    world.RunExperiment();
+    return 0;
+  }
+
+  if(config.ARRAY_STORAGE() == 1){
+    if(!ArrayWorld::CanUseArrays(config)){
+      std::cerr << "Array storage needs FREE_LIVING_SYMS 0, PHYLOGENY 0, THREADS 1, and COUNTER_RNG, SKIP_EMPTY_CELLS, SYNCHRONOUS and EVENT_DRIVEN off." << std::endl;
+      exit(1);
+    }
+    if(config.REPLICATES() > 1){
+      Ensemble<ArrayWorld> ensemble(config);
+      ensemble.Setup();
+      ensemble.RunExperiment();
+      return 0;
+    }
+    ArrayWorld world(random, &config);
+    world.Setup();
+    world.CreateDataFiles();
+    world.RunExperiment();
+    return 0;
+  }
+
+  if(config.REPLICATES() > 1){
+    Ensemble<SymWorldT<GenotypeCountWorld, Host, Symbiont>> ensemble(config);
+    ensemble.Setup();
+    ensemble.RunExperiment();
+    if(config.PHYLOGENY() == 1){
+      ensemble.ForEachReplicate([](SymWorld & world, SymConfigBase & replicate_config){
+        std::string file_ending = "_SEED"+std::to_string(replicate_config.SEED())+".data";
+        world.WritePhylogenyFile(replicate_config.FILE_PATH()+"Phylogeny_"+replicate_config.FILE_NAME()+file_ending);
+      });
+    }
+    return 0;
+  }
+
+  SymWorldT<GenotypeCountWorld, Host, Symbiont> world(random, &config);
 
 
   world.Setup();
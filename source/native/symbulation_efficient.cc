@@ -1,6 +1,8 @@
 #include "../efficient_mode/EfficientWorld.h"
 #include "../efficient_mode/EfficientWorldSetup.cc"
 #include "../default_mode/WorldSetup.cc"
+#include "../default_mode/SymWorldT.h"
+#include "../default_mode/Ensemble.h"
 #include "symbulation.h"
 
 // This is the main function for the NATIVE version of this project.
@@ -13,7 +15,14 @@ int symbulation_main(int argc, char * argv[])
   config.Write(std::cout);
   emp::Random random(config.SEED());
 
-  EfficientWorld world(random, &config);
+  if(config.REPLICATES() > 1){
+    Ensemble<SymWorldT<EfficientWorld, EfficientHost, EfficientSymbiont>> ensemble(config);
+    ensemble.Setup();
+    ensemble.RunExperiment();
+    return 0;
+  }
+
+  SymWorldT<EfficientWorld, EfficientHost, EfficientSymbiont> world(random, &config);
 
   world.Setup();
   world.CreateDataFiles();
@@ -1,6 +1,8 @@
 #include "../lysis_mode/LysisWorld.h"
 #include "../default_mode/WorldSetup.cc"
 #include "../lysis_mode/LysisWorldSetup.cc"
+#include "../default_mode/SymWorldT.h"
+#include "../default_mode/Ensemble.h"
 #include "symbulation.h"
 
 /**
@@ -28,7 +30,14 @@ int symbulation_main(int argc, char * argv[])
   config.Write(std::cout);
   emp::Random random(config.SEED());
 
-  LysisWorld world(random, &config);
+  if(config.REPLICATES() > 1){
+    Ensemble<SymWorldT<LysisWorld, Bacterium, Phage>> ensemble(config);
+    ensemble.Setup();
+    ensemble.RunExperiment();
+    return 0;
+  }
+
+  SymWorldT<LysisWorld, Bacterium, Phage> world(random, &config);
 
   world.Setup();
   world.CreateDataFiles();
@@ -1,6 +1,8 @@
 #include "../pgg_mode/PGGWorld.h"
 #include "../pgg_mode/PGGWorldSetup.cc"
 #include "../default_mode/WorldSetup.cc"
+#include "../default_mode/SymWorldT.h"
+#include "../default_mode/Ensemble.h"
 #include "symbulation.h"
 
 // This is the main function for the NATIVE version of this project.
@@ -13,7 +15,14 @@ int symbulation_main(int argc, char * argv[])
   config.Write(std::cout);
   emp::Random random(config.SEED());
 
-  PGGWorld world(random, &config);
+  if(config.REPLICATES() > 1){
+    Ensemble<SymWorldT<PGGWorld, PGGHost, PGGSymbiont>> ensemble(config);
+    ensemble.Setup();
+    ensemble.RunExperiment();
+    return 0;
+  }
+
+  SymWorldT<PGGWorld, PGGHost, PGGSymbiont> world(random, &config);
 
   world.Setup();
   world.CreateDataFiles();
@@ -15,18 +15,20 @@ protected:
   */
   double sourcepool = 0;
 
+public:
   /**
-    *
-    * Purpose: Represents the world that the PGGHosts are living in.
-    *
-  */
-  emp::Ptr<PGGWorld> my_world = NULL;
+   * Input: None
+   *
+   * Output: The PGGWorld the PGG host lives in.
+   *
+   * Purpose: To get the PGG host's world as a PGGWorld.
+   */
+  emp::Ptr<PGGWorld> GetWorld() {return Host::GetWorld().Cast<PGGWorld>();}
 
-public:
   PGGHost(emp::Ptr<emp::Random> _random, emp::Ptr<PGGWorld> _world, emp::Ptr<SymConfigBase> _config,
   double _intval =0.0, emp::vector<emp::Ptr<Organism>> _syms = {},
   emp::vector<emp::Ptr<Organism>> _repro_syms = {},
-  double _points = 0.0) : Host(_random, _world, _config, _intval,_syms, _repro_syms, _points) {my_world = _world;}
+  double _points = 0.0) : Host(_random, _world, _config, _intval,_syms, _repro_syms, _points) {}
 
 
   /**
@@ -69,6 +71,17 @@ public:
     return  "PGGHost";
   }
 
+  /**
+  * Input: None
+  *
+  * Output: The size in bytes of a PGGHost object
+  *
+  * Purpose: To account for the memory organisms take up by their exact type
+  */
+  size_t GetObjectSize() {
+    return sizeof(PGGHost);
+  }
+
   /**
    * Input: None
    *
@@ -129,7 +142,7 @@ public:
   void DistribPool(){
     //to do: marginal return
     int num_sym = syms.size();
-    double bonus = my_config->PGG_SYNERGY();
+    double bonus = GetConfig()->PGG_SYNERGY();
     double sym_piece = (double) sourcepool / num_sym;
     for(size_t i=0; i < syms.size(); i++){
         syms[i]->AddPoints(sym_piece*bonus);
@@ -145,7 +158,7 @@ public:
    * Purpose: To avoid creating an organism via constructor in other methods.
    */
   emp::Ptr<Organism> MakeNew(){
-    emp::Ptr<PGGHost> host_baby = emp::NewPtr<PGGHost>(random, my_world, my_config, GetIntVal());
+    emp::Ptr<PGGHost> host_baby = emp::NewPtr<PGGHost>(context->random, GetWorld(), GetConfig(), GetIntVal());
     return host_baby;
   }
 
@@ -12,18 +12,20 @@ protected:
     * Purpose: the donation value for this symbiont.
     *
   */
-  double PGG_donate = 0;
+  trait_t PGG_donate = 0;
 
+public:
   /**
-    *
-    * Purpose: Represents the world that the pgg symbionts are living in.
-    *
-  */
-  emp::Ptr<PGGWorld> my_world = NULL;
+   * Input: None
+   *
+   * Output: The PGGWorld the PGG symbiont lives in.
+   *
+   * Purpose: To get the PGG symbiont's world as a PGGWorld.
+   */
+  emp::Ptr<PGGWorld> GetWorld() {return Symbiont::GetWorld().Cast<PGGWorld>();}
 
-public:
   PGGSymbiont(emp::Ptr<emp::Random> _random, emp::Ptr<PGGWorld> _world, emp::Ptr<SymConfigBase> _config, double _intval=0.0, double _donation = 0.0, double _points = 0.0 ) : Symbiont(_random, _world, _config, _intval, _points),PGG_donate(_donation)
-  {my_world = _world;}
+  {}
 
 
   /**
@@ -86,6 +88,17 @@ public:
     return  "PGGSymbiont";
   }
 
+  /**
+  * Input: None
+  *
+  * Output: The size in bytes of a PGGSymbiont object
+  *
+  * Purpose: To account for the memory organisms take up by their exact type
+  */
+  size_t GetObjectSize() {
+    return sizeof(PGGSymbiont);
+  }
+
   /**
    * Input: None
    *
@@ -117,8 +130,8 @@ public:
    */
   void Mutate(){
     Symbiont::Mutate();
-    if (random->GetDouble(0.0, 1.0) <= my_config->MUTATION_RATE()) {
-      PGG_donate += random->GetRandNormal(0.0, my_config->MUTATION_SIZE());
+    if (GetRandom().GetDouble(0.0, 1.0) <= GetConfig()->MUTATION_RATE()) {
+      PGG_donate += GetRandom().GetRandNormal(0.0, GetConfig()->MUTATION_SIZE());
       if(PGG_donate < 0) PGG_donate = 0;
       else if (PGG_donate > 1) PGG_donate = 1;
     }
@@ -150,7 +163,7 @@ public:
    * Purpose: To produce a new PGGSymbiont, identical to the original
    */
   emp::Ptr<Organism> MakeNew() {
-    emp::Ptr<PGGSymbiont> sym_baby = emp::NewPtr<PGGSymbiont>(random, my_world, my_config, GetIntVal());
+    emp::Ptr<PGGSymbiont> sym_baby = emp::NewPtr<PGGSymbiont>(context->random, GetWorld(), GetConfig(), GetIntVal());
     sym_baby->SetInfectionChance(GetInfectionChance());
     sym_baby->SetDonation(GetDonation());
     return sym_baby;
@@ -0,0 +1,139 @@
+#include "../../default_mode/ArrayWorld.h"
+
+/**
+ * Input: A world of organism objects and a world whose arrays have been stored back into pop.
+ *
+ * Output: None
+ *
+ * Purpose: To require that the two populations are the same, cell by cell.
+ */
+void RequireSamePopulation(SymWorld & world, ArrayWorld & array_world) {
+  REQUIRE(array_world.GetNumOrgs() == world.GetNumOrgs());
+  for (size_t i = 0; i < world.GetSize(); i++) {
+    REQUIRE(array_world.IsOccupied(i) == world.IsOccupied(i));
+    if (!world.IsOccupied(i)) continue;
+    Organism & host = world.GetOrg(i);
+    Organism & array_host = array_world.GetOrg(i);
+    REQUIRE(array_host.GetIntVal() == host.GetIntVal());
+    REQUIRE(array_host.GetPoints() == host.GetPoints());
+    REQUIRE(array_host.GetAge() == host.GetAge());
+    REQUIRE(array_host.GetSymbionts().size() == host.GetSymbionts().size());
+    for (size_t j = 0; j < host.GetSymbionts().size(); j++) {
+      REQUIRE(array_host.GetSymbionts()[j]->GetIntVal() == host.GetSymbionts()[j]->GetIntVal());
+      REQUIRE(array_host.GetSymbionts()[j]->GetPoints() == host.GetSymbionts()[j]->GetPoints());
+      REQUIRE(array_host.GetSymbionts()[j]->GetAge() == host.GetSymbionts()[j]->GetAge());
+    }
+  }
+}
+
+TEST_CASE("Array storage", "[default]") {
+  GIVEN("a world of organism objects and an array world with the same seed and settings") {
+    SymConfigBase config;
+    config.GRID_X(10);
+    config.GRID_Y(10);
+    config.POP_SIZE(60);
+    config.START_MOI(1);
+    config.HOST_INT(-2);
+    config.SYM_INT(-2);
+    config.SYM_LIMIT(3);
+    config.MUTATION_SIZE(0.05);
+    config.HOST_REPRO_RES(300);
+    config.SYM_HORIZ_TRANS_RES(50);
+    config.SYM_VERT_TRANS_RES(10);
+    config.SYM_AGE_MAX(40);
+    config.DATA_INT(1000);
+    int num_updates = 60;
+
+    WHEN("the world is well-mixed") {
+      config.GRID(0);
+      emp::Random random(23);
+      SymWorld world(random, &config);
+      world.Setup();
+      emp::Random array_random(23);
+      ArrayWorld array_world(array_random, &config);
+      array_world.Setup();
+
+      for (int i = 0; i < num_updates; i++) {
+        world.Update();
+        array_world.Update();
+      }
+      array_world.StorePopulation();
+
+      THEN("the arrays give the same population as the organisms") {
+        REQUIRE(array_world.IsLoaded());
+        RequireSamePopulation(world, array_world);
+        REQUIRE(array_world.GetHorizontalTransmissionAttemptCount().GetTotal() ==
+          world.GetHorizontalTransmissionAttemptCount().GetTotal());
+        REQUIRE(array_world.GetVerticalTransmissionAttemptCount().GetTotal() ==
+          world.GetVerticalTransmissionAttemptCount().GetTotal());
+      }
+    }
+
+    WHEN("the world is a grid with limited resources") {
+      config.GRID(1);
+      config.LIMITED_RES_TOTAL(20000);
+      config.LIMITED_RES_INFLOW(500);
+      emp::Random random(29);
+      SymWorld world(random, &config);
+      world.Setup();
+      emp::Random array_random(29);
+      ArrayWorld array_world(array_random, &config);
+      array_world.Setup();
+
+      for (int i = 0; i < num_updates; i++) {
+        world.Update();
+        array_world.Update();
+      }
+      array_world.StorePopulation();
+
+      THEN("the arrays give the same population as the organisms") {
+        RequireSamePopulation(world, array_world);
+      }
+    }
+
+    WHEN("both worlds write their host and symbiont files") {
+      config.GRID(0);
+      emp::Random random(31);
+      SymWorld world(random, &config);
+      world.Setup();
+      world.SetupHostIntValFile("HostVals_objects_test.data").SetTimingRepeat(7);
+      world.SetupSymIntValFile("SymVals_objects_test.data").SetTimingRepeat(7);
+      emp::Random array_random(31);
+      ArrayWorld array_world(array_random, &config);
+      array_world.Setup();
+      array_world.SetupHostIntValFile("HostVals_arrays_test.data").SetTimingRepeat(7);
+      array_world.SetupSymIntValFile("SymVals_arrays_test.data").SetTimingRepeat(7);
+
+      for (int i = 0; i < num_updates; i++) {
+        world.Update();
+        array_world.Update();
+      }
+
+      auto read_rows = [](const std::string & filename) {
+        emp::vector<std::string> rows;
+        std::ifstream file(filename);
+        for (std::string row; std::getline(file, row);) rows.push_back(row);
+        std::remove(filename.c_str());
+        return rows;
+      };
+      emp::vector<std::string> host_rows = read_rows("HostVals_objects_test.data");
+      emp::vector<std::string> sym_rows = read_rows("SymVals_objects_test.data");
+      emp::vector<std::string> array_host_rows = read_rows("HostVals_arrays_test.data");
+      emp::vector<std::string> array_sym_rows = read_rows("SymVals_arrays_test.data");
+
+      THEN("the arrays' files print the same rows as the organisms' files") {
+        REQUIRE(host_rows.size() == (size_t) num_updates / 7 + 1);
+        REQUIRE(array_host_rows == host_rows);
+        REQUIRE(array_sym_rows == sym_rows);
+      }
+    }
+
+    WHEN("free-living symbionts are on") {
+      config.FREE_LIVING_SYMS(1);
+
+      THEN("the arrays can't be used") {
+        REQUIRE(ArrayWorld::CanUseArrays(config) == false);
+      }
+    }
+  }
+}
@@ -741,3 +741,340 @@ TEST_CASE("GetVerticalTransmissionAttemptCount", "[default]"){
     }
   }
 }
+
+/**
+ * Input: None
+ *
+ * Output: None
+ *
+ * Purpose: Holds what a plain scan of every cell of a world finds, to check
+ * the data monitors and population counts the world keeps against.
+ */
+struct PopulationScan {
+  size_t hosts = 0;
+  size_t hosted_syms = 0;
+  size_t infected_hosts = 0;
+  size_t free_syms = 0;
+  double sym_intval_total = 0;
+  double free_sym_intval_total = 0;
+  double hosted_sym_chance_total = 0;
+
+  PopulationScan(SymWorld & world) {
+    for (size_t i = 0; i < world.GetPop().size(); i++) {
+      if (world.IsOccupied(i)) {
+        hosts++;
+        SymbiontList & hosted = world.GetOrg(i).GetSymbionts();
+        hosted_syms += hosted.size();
+        if (!hosted.empty()) infected_hosts++;
+        for (emp::Ptr<Organism> sym : hosted) {
+          sym_intval_total += sym->GetIntVal();
+          hosted_sym_chance_total += sym->GetInfectionChance();
+        }
+      }
+      if (world.GetSymAt(i)) {
+        free_syms++;
+        sym_intval_total += world.GetSymAt(i)->GetIntVal();
+        free_sym_intval_total += world.GetSymAt(i)->GetIntVal();
+      }
+    }
+  }
+
+  bool MatchesCounts(SymWorld & world) const {
+    return hosts == world.GetNumHosts() && hosted_syms == world.GetNumHostedSyms()
+      && infected_hosts == world.GetNumInfectedHosts() && free_syms == world.GetNumFreeSyms();
+  }
+};
+
+/**
+ * Input: The world to fill, its config and generator, the number of cells,
+ * the lowest interaction value a symbiont can get, and the chance that a cell
+ * gets a free-living symbiont.
+ *
+ * Output: None
+ *
+ * Purpose: To fill a large world without running it: about 70% of the cells
+ * get a host carrying up to three symbionts.
+ */
+void FillStatsWorld(SymWorld & world, SymConfigBase & config, emp::Random & random,
+  size_t world_size, double min_sym_int, double free_sym_chance) {
+  world.Resize(world_size);
+  for (size_t i = 0; i < world_size; i++) {
+    if (random.P(0.7)) {
+      emp::Ptr<Organism> host = emp::NewPtr<Host>(&random, &world, &config, random.GetDouble(-1, 1));
+      for (size_t j = random.GetUInt(4); j > 0; j--) {
+        host->AddSymbiont(emp::NewPtr<Symbiont>(&random, &world, &config, random.GetDouble(min_sym_int, 1)));
+      }
+      world.AddOrgAt(host, i);
+    }
+    if (free_sym_chance > 0 && random.P(free_sym_chance)) {
+      world.AddOrgAt(emp::NewPtr<Symbiont>(&random, &world, &config, random.GetDouble(-1, 1)), emp::WorldPosition(0, i));
+    }
+  }
+}
+
+/**
+ * The count, interaction value and infection chance monitors are all fed by
+ * one pass over the population; each must still hold what it would have
+ * gathered on its own.
+ */
+TEST_CASE("Data monitors collected in one pass", "[default]") {
+  GIVEN("a world with hosted and free-living symbionts and every monitor") {
+    emp::Random random(23);
+    SymConfigBase config;
+    config.FREE_LIVING_SYMS(1);
+    config.GRID_X(15);
+    config.GRID_Y(15);
+    config.SYM_LIMIT(3);
+    SymWorld world(random, &config);
+    world.Setup();
+
+    emp::DataMonitor<int> & host_count = world.GetHostCountDataNode();
+    emp::DataMonitor<int> & sym_count = world.GetSymCountDataNode();
+    emp::DataMonitor<int> & free_count = world.GetCountFreeSymsDataNode();
+    emp::DataMonitor<int> & uninfected = world.GetUninfectedHostsDataNode();
+    emp::DataMonitor<double, emp::data::Histogram> & sym_intval = world.GetSymIntValDataNode();
+    emp::DataMonitor<double, emp::data::Histogram> & free_intval = world.GetFreeSymIntValDataNode();
+    emp::DataMonitor<double, emp::data::Histogram> & hosted_chance = world.GetHostedSymInfectChanceDataNode();
+
+    for (int i = 0; i < 10; i++) world.Update();
+
+    THEN("each monitor holds what a scan of its own would have given it") {
+      PopulationScan scan(world);
+      world.Update(); //the monitors are computed at the start of the update
+      REQUIRE(host_count.GetTotal() == scan.hosts);
+      REQUIRE(sym_count.GetTotal() == scan.hosted_syms + scan.free_syms);
+      REQUIRE(free_count.GetTotal() == scan.free_syms);
+      REQUIRE(uninfected.GetTotal() == scan.hosts - scan.infected_hosts);
+      REQUIRE(sym_intval.GetTotal() == scan.sym_intval_total);
+      REQUIRE(free_intval.GetTotal() == scan.free_sym_intval_total);
+      REQUIRE(hosted_chance.GetTotal() == scan.hosted_sym_chance_total);
+    }
+  }
+}
+
+/**
+ * The monitors are only recomputed on updates where a data file prints them,
+ * so the updates in between skip the pass over the population.
+ */
+TEST_CASE("Data monitors computed only when printed", "[default]") {
+  GIVEN("a world with a file printing its host monitors") {
+    emp::Random random(31);
+    SymConfigBase config;
+    config.GRID_X(10);
+    config.GRID_Y(10);
+    SymWorld world(random, &config);
+    world.Setup();
+
+    std::string filename = "HostVals_lazy_monitors_test.data";
+    emp::DataFile & file = world.SetupHostIntValFile(filename);
+    file.SetTimingRepeat(1000);
+    emp::DataMonitor<int> & host_count = world.GetHostCountDataNode();
+
+    world.Update();
+    world.Update();
+    world.CollectStats();
+    int hosts_before = host_count.GetTotal();
+    for (size_t i = 0; i < 5; i++) {
+      if (world.IsOccupied(i)) world.DoDeath(i);
+    }
+    int hosts_after = (int) world.GetNumOrgs();
+
+    WHEN("an update is not printed") {
+      world.Update();
+      THEN("the monitors are not recomputed") {
+        REQUIRE(hosts_after < hosts_before);
+        REQUIRE(host_count.GetTotal() == hosts_before);
+      }
+      THEN("they can still be recomputed on request") {
+        world.CollectStats();
+        REQUIRE(host_count.GetTotal() == (int) world.GetNumOrgs());
+      }
+    }
+
+    WHEN("an update is printed") {
+      file.SetTimingRepeat(1);
+      world.Update();
+      THEN("the monitors are recomputed before the file prints") {
+        REQUIRE(host_count.GetTotal() == hosts_after);
+      }
+    }
+
+    std::remove(filename.c_str());
+  }
+}
+
+/**
+ * The world keeps its host, symbiont and infection counts up to date as
+ * organisms are born, infect, and die, instead of scanning for them.
+ */
+TEST_CASE("Population counts", "[default]") {
+  GIVEN("a world with hosted and free-living symbionts") {
+    emp::Random random(37);
+    SymConfigBase config;
+    config.FREE_LIVING_SYMS(1);
+    config.GRID_X(12);
+    config.GRID_Y(12);
+    config.SYM_LIMIT(3);
+    config.SYM_AGE_MAX(5);
+    config.HOST_AGE_MAX(8);
+    SymWorld world(random, &config);
+    world.Setup();
+
+    auto scan_matches = [&world]() { return PopulationScan(world).MatchesCounts(world); };
+
+    WHEN("the world is updated") {
+      THEN("the counts follow every birth, death and infection") {
+        for (int i = 0; i < 30; i++) {
+          world.Update();
+          REQUIRE(scan_matches());
+        }
+        REQUIRE(world.GetNumLyticHosts() == 0);
+      }
+    }
+
+    WHEN("hosts gain and lose symbionts and die") {
+      size_t host_pos = 0;
+      while (!world.IsOccupied(host_pos)) host_pos++;
+      emp::Ptr<Organism> host = world.GetPop()[host_pos];
+      host->ClearSyms();
+      host->AddSymbiont(emp::NewPtr<Symbiont>(&random, &world, &config, 0.5));
+      REQUIRE(scan_matches());
+      host->ClearSyms();
+      REQUIRE(scan_matches());
+      host->AddSymbiont(emp::NewPtr<Symbiont>(&random, &world, &config, 0.5));
+      world.DoDeath(host_pos);
+
+      THEN("the counts follow") {
+        REQUIRE(scan_matches());
+        REQUIRE(world.CountsMatchPopulation());
+      }
+    }
+
+    WHEN("a host is not in the world") {
+      size_t hosted_syms = world.GetNumHostedSyms();
+      Host host(&random, &world, &config, 0);
+      host.AddSymbiont(emp::NewPtr<Symbiont>(&random, &world, &config, 0.5));
+
+      THEN("its symbionts are not counted") {
+        REQUIRE(world.GetNumHostedSyms() == hosted_syms);
+      }
+    }
+  }
+}
+
+/**
+ * With THREADS above 1 the monitors are gathered in slices on several
+ * threads and then merged; the merged monitors must match the serial ones
+ * exactly, not just to rounding.
+ */
+TEST_CASE("Data monitors collected on several threads", "[default]") {
+  GIVEN("a world large enough to be split between threads") {
+    emp::Random random(43);
+    SymConfigBase config;
+    config.FREE_LIVING_SYMS(1);
+    config.SYM_LIMIT(3);
+    SymWorld world(random, &config);
+    //more than two of the slices the statistics are gathered in
+    FillStatsWorld(world, config, random, 140000, -1, 0.3);
+
+    emp::vector<emp::DataMonitor<double, emp::data::Histogram> *> nodes = {
+      &world.GetHostIntValDataNode(), &world.GetSymIntValDataNode(),
+      &world.GetFreeSymIntValDataNode(), &world.GetHostedSymInfectChanceDataNode()
+    };
+    auto summarize = [&nodes]() {
+      emp::vector<double> summary;
+      for (auto node : nodes) {
+        for (double val : {node->GetTotal(), node->GetMean(), node->GetVariance(), node->GetMin(), node->GetMax()}) {
+          summary.push_back(val);
+        }
+        for (size_t count : node->GetHistCounts()) summary.push_back(count);
+        summary.push_back(node->GetCount());
+      }
+      return summary;
+    };
+
+    world.CollectStats();
+    emp::vector<double> serial = summarize();
+
+    WHEN("the statistics are computed on several threads") {
+      THEN("every monitor reports exactly what it does on one thread") {
+        for (int threads : {2, 3}) {
+          config.THREADS(threads);
+          world.CollectStats();
+          REQUIRE(summarize() == serial);
+          REQUIRE(world.GetSymIntValDataNode().GetCount() == world.GetNumHostedSyms() + world.GetNumFreeSyms());
+        }
+      }
+    }
+  }
+}
+
+/**
+ * With STATS_SAMPLE set, the monitors are estimated from a sample of the
+ * cells, drawn without touching the world's generator, and the data files
+ * report a standard error next to each mean.
+ */
+TEST_CASE("Data monitors estimated from a sample of cells", "[default]") {
+  GIVEN("a world with hosts and symbionts in most cells") {
+    emp::Random random(47);
+    SymConfigBase config;
+    config.SYM_LIMIT(3);
+    SymWorld world(random, &config);
+    size_t world_size = 4000;
+    FillStatsWorld(world, config, random, world_size, -0.5, 0);
+
+    emp::DataMonitor<double, emp::data::Histogram> & host_node = world.GetHostIntValDataNode();
+    emp::DataMonitor<double, emp::data::Histogram> & sym_node = world.GetSymIntValDataNode();
+    world.CollectStats();
+    double host_mean = host_node.GetMean();
+    double sym_mean = sym_node.GetMean();
+    emp::vector<size_t> host_hist = host_node.GetHistCounts();
+
+    WHEN("the statistics are taken from a sample of the cells") {
+      config.STATS_SAMPLE(1000);
+      emp::Random before = random;
+      world.CollectStats();
+
+      THEN("the means are estimates with standard errors") {
+        double host_se = world.GetStatsStandardError(&host_node);
+        double sym_se = world.GetStatsStandardError(&sym_node);
+        REQUIRE(host_se > 0);
+        REQUIRE(sym_se > 0);
+        REQUIRE(std::abs(host_node.GetMean() - host_mean) < 4 * host_se);
+        REQUIRE(std::abs(sym_node.GetMean() - sym_mean) < 4 * sym_se);
+        REQUIRE(host_node.GetCount() < world.GetNumHosts());
+      }
+      THEN("scaling the histogram up estimates the whole world's") {
+        double estimated_hosts = 0;
+        for (size_t count : host_node.GetHistCounts()) estimated_hosts += count * 4.0;
+        REQUIRE(std::abs(estimated_hosts - world.GetNumHosts()) < 0.1 * world.GetNumHosts());
+      }
+      THEN("the world's random number generator is left alone") {
+        REQUIRE(before.GetDouble() == random.GetDouble());
+      }
+    }
+
+    WHEN("the sample would be as large as the world") {
+      config.STATS_SAMPLE(world_size);
+      world.CollectStats();
+      THEN("every cell is gone through") {
+        REQUIRE(host_node.GetMean() == host_mean);
+        REQUIRE(host_node.GetHistCounts() == host_hist);
+        REQUIRE(world.GetStatsStandardError(&host_node) == 0);
+      }
+    }
+
+    WHEN("a file is set up while sampling") {
+      config.STATS_SAMPLE(1000);
+      std::string filename = "HostVals_sampled_test.data";
+      world.SetupHostIntValFile(filename);
+      std::ifstream data(filename);
+      std::string header;
+      std::getline(data, header);
+      THEN("each mean is followed by its standard error") {
+        REQUIRE(header.find("mean_intval,mean_intval_se,") != std::string::npos);
+      }
+      std::remove(filename.c_str());
+    }
+  }
+}
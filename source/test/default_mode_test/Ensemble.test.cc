@@ -0,0 +1,47 @@
+#include "../../default_mode/Ensemble.h"
+
+TEST_CASE("Ensemble", "[default]") {
+  GIVEN("a config asking for three replicates") {
+    SymConfigBase config;
+    config.SEED(5);
+    config.REPLICATES(3);
+    config.GRID_X(10);
+    config.GRID_Y(10);
+    config.START_MOI(0.5);
+    config.UPDATES(20);
+    config.DATA_INT(1000);
+    Ensemble<SymWorld> ensemble(config);
+
+    THEN("each replicate gets its own seed") {
+      REQUIRE(ensemble.GetSize() == 3);
+      REQUIRE(ensemble.GetConfig(0).SEED() == 5);
+      REQUIRE(ensemble.GetConfig(1).SEED() == 6);
+      REQUIRE(ensemble.GetConfig(2).SEED() == 7);
+      REQUIRE(ensemble.GetConfig(2).GRID_X() == 10);
+      REQUIRE(ensemble.GetConfig(2).START_MOI() == 0.5);
+    }
+
+    WHEN("the replicates are run") {
+      ensemble.ForEachReplicate([](SymWorld & world, SymConfigBase &) {world.Setup();});
+      ensemble.RunExperiment(false);
+
+      config.SEED(6);
+      emp::Random random(6);
+      SymWorld world(random, &config);
+      world.Setup();
+      world.RunExperiment(false);
+
+      THEN("a replicate ends up as a run with its seed on its own would") {
+        SymWorld & replicate = ensemble.GetWorld(1);
+        REQUIRE(replicate.GetNumOrgs() == world.GetNumOrgs());
+        for (size_t i = 0; i < world.GetSize(); i++) {
+          REQUIRE(replicate.IsOccupied(i) == world.IsOccupied(i));
+          if (world.IsOccupied(i)) {
+            REQUIRE(replicate.GetOrg(i).GetIntVal() == world.GetOrg(i).GetIntVal());
+            REQUIRE(replicate.GetOrg(i).GetPoints() == world.GetOrg(i).GetPoints());
+          }
+        }
+      }
+    }
+  }
+}
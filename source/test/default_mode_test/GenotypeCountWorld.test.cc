@@ -0,0 +1,132 @@
+#include "../../default_mode/GenotypeCountWorld.h"
+
+TEST_CASE("Aggregated no-mutation updates", "[default]") {
+  GIVEN("a well-mixed world of identical hosts, half of them infected") {
+    emp::Random random(17);
+    SymConfigBase config;
+    config.AGGREGATE_NO_MUT(1);
+    config.GRID(0);
+    config.RES_DISTRIBUTE(100);
+    config.HOST_REPRO_RES(200);
+    config.SYM_HORIZ_TRANS_RES(50);
+    config.UPDATES(0);
+    config.NO_MUT_UPDATES(60);
+    config.DATA_INT(1000);
+    double host_int_val = 0.5;
+    double sym_int_val = 0.2;
+
+    GenotypeCountWorld world(random, &config);
+    world.SetPopStruct_Mixed(false);
+    world.Resize(100);
+    for (size_t i = 0; i < 40; i++) {
+      emp::Ptr<Host> host = emp::NewPtr<Host>(&random, &world, &config, host_int_val);
+      if (i < 20) host->AddSymbiont(emp::NewPtr<Symbiont>(&random, &world, &config, sym_int_val));
+      world.AddOrgAt(host, i);
+    }
+
+    WHEN("the population is aggregated") {
+      bool aggregated = world.AggregateGenotypes();
+
+      THEN("identical hosts share a genotype and a cohort") {
+        REQUIRE(world.CanAggregateGenotypes());
+        REQUIRE(aggregated);
+        REQUIRE(world.IsAggregated());
+        REQUIRE(world.GetGenotypeCount() == 2);
+        REQUIRE(world.GetCohortCount() == 2);
+        REQUIRE(world.GetHostCount() == 40);
+      }
+
+      THEN("expanding the groups rebuilds the population") {
+        world.ExpandGenotypes();
+        size_t num_syms = 0;
+        for (size_t i = 0; i < world.GetSize(); i++) {
+          if (world.IsOccupied(i)) num_syms += world.GetOrg(i).GetSymbionts().size();
+        }
+        REQUIRE(world.GetNumOrgs() == 40);
+        REQUIRE(num_syms == 20);
+      }
+    }
+
+    WHEN("the hosts differ in their points") {
+      for (size_t i = 0; i < 40; i++) world.GetOrg(i).SetPoints(i % 4);
+      world.AggregateGenotypes();
+
+      THEN("each genotype keeps a cohort per number of points") {
+        REQUIRE(world.GetGenotypeCount() == 2);
+        REQUIRE(world.GetCohortCount() == 8);
+      }
+    }
+
+    WHEN("most hosts have a genotype of their own") {
+      for (size_t i = 0; i < 30; i++) world.GetOrg(i).SetIntVal(0.01 * i);
+      bool aggregated = world.AggregateGenotypes();
+
+      THEN("the counts can't pay off, so the population is left as it is") {
+        REQUIRE(aggregated == false);
+        REQUIRE(world.IsAggregated() == false);
+        REQUIRE(world.GetGenotypeCount() == 0);
+        REQUIRE(world.GetNumOrgs() == 40);
+      }
+    }
+
+    WHEN("the aggregated updates print a file") {
+      std::string filename = "HostVals_genotype_counts_test.data";
+      emp::DataFile & file = world.SetupHostIntValFile(filename);
+      file.SetTimingRepeat(5);
+      emp::vector<size_t> hosts_in_counts;
+      file.AddPreFun([&world, &hosts_in_counts](){ hosts_in_counts.push_back(world.GetHostCount()); });
+      world.AggregateGenotypes();
+      for (int i = 0; i < 40; i++) world.UpdateGenotypes();
+
+      emp::vector<size_t> hosts_printed;
+      std::ifstream rows(filename);
+      std::string row;
+      std::getline(rows, row);
+      while (std::getline(rows, row)) {
+        std::stringstream fields(row);
+        std::string field;
+        for (size_t col = 0; col < 3; col++) std::getline(fields, field, ',');
+        hosts_printed.push_back(std::stoul(field));
+      }
+      std::remove(filename.c_str());
+
+      THEN("each row reports the population the counts hold when it is printed") {
+        REQUIRE(hosts_printed.size() == 8);
+        REQUIRE(hosts_printed == hosts_in_counts);
+        REQUIRE(hosts_printed.front() != hosts_printed.back());
+      }
+    }
+
+    WHEN("the world is a grid") {
+      config.GRID(1);
+
+      THEN("it is not aggregated") {
+        REQUIRE(world.CanAggregateGenotypes() == false);
+      }
+    }
+
+    WHEN("the experiment is run") {
+      emp::DataMonitor<int>& attempts_node = world.GetHorizontalTransmissionAttemptCount();
+      emp::DataMonitor<int>& successes_node = world.GetHorizontalTransmissionSuccessCount();
+      world.RunExperiment(false);
+
+      THEN("the hosts reproduce and the symbionts spread, without any new genotypes") {
+        size_t num_syms = 0;
+        for (size_t i = 0; i < world.GetSize(); i++) {
+          if (!world.IsOccupied(i)) continue;
+          REQUIRE(world.GetOrg(i).GetIntVal() == host_int_val);
+          for (emp::Ptr<Organism> sym : world.GetOrg(i).GetSymbionts()) {
+            REQUIRE(sym->GetIntVal() == sym_int_val);
+            num_syms++;
+          }
+        }
+        REQUIRE(world.GetNumOrgs() > 40);
+        REQUIRE(world.GetNumOrgs() <= 100);
+        REQUIRE(num_syms > 20);
+        REQUIRE(attempts_node.GetTotal() > 0);
+        REQUIRE(successes_node.GetTotal() > 0);
+        REQUIRE(successes_node.GetTotal() <= attempts_node.GetTotal());
+      }
+    }
+  }
+}
@@ -500,7 +500,7 @@ TEST_CASE("AddSymbiont", "[default]"){
 
   WHEN("A symbiont successfully infects"){
     size_t pos = host->AddSymbiont(symbiont);
-    emp::vector<emp::Ptr<Organism>>& host_syms = host->GetSymbionts();
+    SymbiontList& host_syms = host->GetSymbionts();
     THEN("It is added to the host sym vector and it's position is returned"){
       REQUIRE(host->HasSym() == true);
       REQUIRE(pos == host_syms.size());
@@ -517,3 +517,78 @@ TEST_CASE("AddSymbiont", "[default]"){
   }
   host.Delete();
 }
+
+TEST_CASE("Host symbionts beyond the inline capacity", "[default]"){
+  emp::Ptr<emp::Random> random = new emp::Random(-1);
+  SymConfigBase config;
+  config.SYM_LIMIT(6);
+  SymWorld world(*random, &config);
+  emp::Ptr<Host> host = emp::NewPtr<Host>(random, &world, &config, 0);
+  emp::vector<emp::Ptr<Organism>> added;
+
+  WHEN("A host gains more symbionts than fit inside it"){
+    for (size_t i = 0; i < 6; i++) {
+      emp::Ptr<Organism> symbiont = emp::NewPtr<Symbiont>(random, &world, &config, 0.1 * i);
+      host->AddSymbiont(symbiont);
+      added.push_back(symbiont);
+    }
+    THEN("They are all kept, in the order they were added"){
+      REQUIRE(host->GetSymbionts().size() == 6);
+      REQUIRE(host->GetSymbionts() == added);
+    }
+    WHEN("Symbionts are removed"){
+      host->GetSymbionts()[1].Delete();
+      host->GetSymbionts().erase(host->GetSymbionts().begin() + 1);
+      added.erase(added.begin() + 1);
+      THEN("The rest keep their order"){
+        REQUIRE(host->GetSymbionts().size() == 5);
+        REQUIRE(host->GetSymbionts() == added);
+      }
+    }
+  }
+  WHEN("A host is copied"){
+    for (size_t i = 0; i < 2; i++) {
+      host->AddSymbiont(emp::NewPtr<Symbiont>(random, &world, &config, 0.1 * i));
+    }
+    emp::vector<emp::Ptr<Organism>> copied = host->GetSymbionts();
+    THEN("The copy holds the same symbionts"){
+      REQUIRE(copied.size() == 2);
+      REQUIRE(host->GetSymbionts() == copied);
+    }
+  }
+  host.Delete();
+}
+
+TEST_CASE("Host world and config", "[default]"){
+  emp::Ptr<emp::Random> random = new emp::Random(-1);
+  SymConfigBase config;
+  SymWorld world(*random, &config);
+  emp::Ptr<Host> host = emp::NewPtr<Host>(random, &world, &config, 0.5);
+
+  WHEN("A host is made"){
+    THEN("It gets the world and config it was made with"){
+      REQUIRE(host->GetWorld().Raw() == &world);
+      REQUIRE(host->GetConfig().Raw() == &config);
+    }
+  }
+  WHEN("A host reproduces"){
+    emp::Ptr<Organism> baby = host->Reproduce();
+    THEN("Its offspring lives in the same world, with the same config"){
+      REQUIRE(baby.DynamicCast<Host>()->GetWorld().Raw() == &world);
+      REQUIRE(baby.DynamicCast<Host>()->GetConfig().Raw() == &config);
+    }
+    baby.Delete();
+  }
+  WHEN("A host is made for another world"){
+    SymConfigBase other_config;
+    SymWorld other_world(*random, &other_config);
+    emp::Ptr<Host> other_host = emp::NewPtr<Host>(random, &other_world, &other_config, 0.5);
+    THEN("It gets that world and config, and the first host keeps its own"){
+      REQUIRE(other_host->GetWorld().Raw() == &other_world);
+      REQUIRE(other_host->GetConfig().Raw() == &other_config);
+      REQUIRE(host->GetWorld().Raw() == &world);
+    }
+    other_host.Delete();
+  }
+  host.Delete();
+}
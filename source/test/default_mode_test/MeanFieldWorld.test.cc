@@ -0,0 +1,153 @@
+#include "../../default_mode/MeanFieldWorld.h"
+
+TEST_CASE("MeanFieldWorld GetBin", "[default]") {
+  THEN("interaction values fall in the histogram bins of the data files") {
+    REQUIRE(MeanFieldWorld::GetBin(-1) == 0);
+    REQUIRE(MeanFieldWorld::GetBin(-0.95) == 0);
+    REQUIRE(MeanFieldWorld::GetBin(0) == 10);
+    REQUIRE(MeanFieldWorld::GetBin(0.55) == 15);
+    REQUIRE(MeanFieldWorld::GetBin(1) == 19);
+    REQUIRE(MeanFieldWorld::GetBinCenter(10) == Approx(0.05));
+  }
+}
+
+TEST_CASE("MeanFieldWorld GetMutationKernel", "[default]") {
+  WHEN("mutations are small") {
+    emp::vector<double> kernel = MeanFieldWorld::GetMutationKernel(1, 0.002);
+
+    THEN("each row is a distribution that mostly stays in its bin") {
+      for (size_t from = 0; from < 20; from++) {
+        double total = 0;
+        for (size_t to = 0; to < 20; to++) total += kernel[from * 20 + to];
+        REQUIRE(total == Approx(1));
+        REQUIRE(kernel[from * 20 + from] > 0.98);
+      }
+    }
+  }
+
+  WHEN("there is no mutation") {
+    emp::vector<double> kernel = MeanFieldWorld::GetMutationKernel(0, 0.002);
+
+    THEN("offspring stay in their parent's bin") {
+      for (size_t from = 0; from < 20; from++) {
+        REQUIRE(kernel[from * 20 + from] == 1);
+      }
+    }
+  }
+}
+
+TEST_CASE("MeanFieldWorld Update", "[default]") {
+  GIVEN("a half-full well-mixed world of uninfected hosts") {
+    emp::Random random(17);
+    SymConfigBase config;
+    config.GRID_X(10);
+    config.GRID_Y(10);
+    config.POP_SIZE(50);
+    config.START_MOI(0);
+    config.HOST_INT(0);
+    config.RES_DISTRIBUTE(100);
+    config.HOST_REPRO_RES(1000);
+    config.MUTATION_RATE(0);
+
+    MeanFieldWorld world(random, &config);
+    world.Setup();
+    REQUIRE(world.GetHostCount() == Approx(50));
+    REQUIRE(world.GetSymCount() == Approx(0));
+
+    WHEN("the world updates") {
+      world.Update();
+
+      THEN("hosts reproduce at their gain over HOST_REPRO_RES into random cells") {
+        // hosts in the 0.0 to 0.1 bin act at 0.05 and keep 95 points, so the
+        // 50 hosts make 4.75 offspring, half of which land in empty cells
+        REQUIRE(world.GetHostCount() == Approx(52.375));
+        REQUIRE(world.GetHostBinCount(10) == Approx(52.375));
+        REQUIRE(world.GetMeanHostIntVal() == Approx(0.05));
+      }
+    }
+  }
+
+  GIVEN("a full well-mixed world where half the hosts are infected by mutualists") {
+    emp::Random random(17);
+    SymConfigBase config;
+    config.GRID_X(10);
+    config.GRID_Y(10);
+    config.HOST_INT(0.5);
+    config.SYM_INT(0.5);
+    config.START_MOI(0.69314718056);
+    config.RES_DISTRIBUTE(100);
+    config.MUTATION_RATE(0);
+
+    MeanFieldWorld world(random, &config);
+    world.Setup();
+    REQUIRE(world.GetSymCount() == Approx(50).epsilon(0.01));
+
+    WHEN("the world runs for a while") {
+      for (int i = 0; i < 200; i++) world.Update();
+
+      THEN("horizontal and vertical transmission spread the symbionts") {
+        REQUIRE(world.GetHostCount() == Approx(100));
+        REQUIRE(world.GetSymCount() > 75);
+        REQUIRE(world.GetSymBinCount(15) == Approx(world.GetSymCount()));
+      }
+    }
+  }
+}
+
+TEST_CASE("MeanFieldWorld data files", "[default]") {
+  GIVEN("a well-mixed world of mutualists writing its data files") {
+    emp::Random random(17);
+    SymConfigBase config;
+    config.GRID_X(10);
+    config.GRID_Y(10);
+    config.HOST_INT(0.5);
+    config.SYM_INT(0.5);
+    config.START_MOI(0.5);
+    config.RES_DISTRIBUTE(100);
+    config.MUTATION_RATE(0);
+    config.DATA_INT(1);
+    config.FILE_PATH("");
+    config.FILE_NAME("_mean_field_test");
+
+    MeanFieldWorld world(random, &config);
+    world.Setup();
+    world.CreateDataFiles();
+    for (int i = 0; i < 30; i++) world.Update();
+
+    auto read_rows = [](const std::string & filename) {
+      emp::vector<emp::vector<std::string>> rows;
+      std::ifstream file(filename);
+      for (std::string line; std::getline(file, line);) {
+        rows.emplace_back();
+        std::stringstream fields(line);
+        for (std::string field; std::getline(fields, field, ',');) rows.back().push_back(field);
+      }
+      std::remove(filename.c_str());
+      return rows;
+    };
+    emp::vector<emp::vector<std::string>> host_rows = read_rows("HostVals_mean_field_test_SEED10.data");
+    emp::vector<emp::vector<std::string>> sym_rows = read_rows("SymVals_mean_field_test_SEED10.data");
+    emp::vector<emp::vector<std::string>> transmission_rows = read_rows("TransmissionRates_mean_field_test_SEED10.data");
+
+    THEN("every column but the mean holds whole counts, as in the agent-based files") {
+      for (emp::vector<emp::vector<std::string>> * rows : {&host_rows, &sym_rows, &transmission_rows}) {
+        REQUIRE(rows->size() == 31);
+        for (size_t row = 1; row < rows->size(); row++) {
+          for (size_t col = 0; col < (*rows)[row].size(); col++) {
+            if ((*rows)[0][col] == "mean_intval") continue;
+            REQUIRE((*rows)[row][col].find_first_not_of("-0123456789") == std::string::npos);
+          }
+        }
+      }
+    }
+
+    THEN("the transmission file counts the expected transmissions") {
+      REQUIRE(transmission_rows[0] == emp::vector<std::string>{"update", "attempts_horiztrans", "successes_horiztrans", "attempts_verttrans"});
+      long vert_attempts = 0;
+      for (size_t row = 1; row < transmission_rows.size(); row++) vert_attempts += std::stol(transmission_rows[row][3]);
+      //the last row is printed before the last update's step
+      REQUIRE(vert_attempts > 0);
+      REQUIRE(std::abs(vert_attempts - world.GetVertTransAttempts()) < world.GetVertTransAttempts() / 10);
+    }
+  }
+}
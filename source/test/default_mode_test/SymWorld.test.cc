@@ -3,6 +3,7 @@
 #include "../../lysis_mode/Phage.h"
 #include "../../lysis_mode/LysisWorld.h"
 #include "../../default_mode/Host.h"
+#include "../../default_mode/SymWorldT.h"
 
 
 TEST_CASE("PullResources", "[default]") {
@@ -1613,4 +1614,899 @@ TEST_CASE("SetupHosts", "[default]") {
       }
     }
   }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Threaded grid update", "[default]") {
+  GIVEN("grid worlds with the same seed") {
+    size_t width = 40;
+    size_t height = 30;
+    int num_updates = 30;
+
+    SymConfigBase config;
+    config.GRID(1);
+    config.GRID_X(width);
+    config.GRID_Y(height);
+    config.POP_SIZE(200);
+    config.START_MOI(1);
+    config.SYM_LIMIT(2);
+    config.HOST_REPRO_RES(200);
+    config.SYM_HORIZ_TRANS_RES(20);
+    config.FREE_LIVING_SYMS(1);
+    config.MOVE_FREE_SYMS(1);
+
+    emp::vector<emp::vector<double>> host_int_vals;
+    for (int num_threads : {2, 4}) {
+      config.THREADS(num_threads);
+      emp::Random random(17);
+      SymWorld world(random, &config);
+      world.Setup();
+      for (int i = 0; i < num_updates; i++) world.Update();
+
+      emp::vector<double> int_vals(width * height, -2);
+      size_t num_orgs = 0;
+      for (size_t i = 0; i < world.GetSize(); i++) {
+        if (world.IsOccupied(i)) {
+          num_orgs++;
+          int_vals[i] = world.GetOrg(i).GetIntVal();
+        }
+        if (world.GetSymAt(i)) num_orgs++;
+      }
+
+      WHEN("the updates are processed on " + emp::to_string(num_threads) + " threads") {
+        THEN("hosts were born across tile boundaries and the organism count is kept correctly") {
+          REQUIRE(world.GetNumOrgs() > 200);
+          REQUIRE(world.GetNumOrgs() == num_orgs);
+        }
+        THEN("every update ran on the same worker threads") {
+          //the grid has two tiles of each colour, so one worker joins the calling thread
+          REQUIRE(world.GetNumTileWorkers() == 1);
+        }
+      }
+      host_int_vals.push_back(int_vals);
+    }
+
+    THEN("the results do not depend on the number of threads") {
+      REQUIRE(host_int_vals[0] == host_int_vals[1]);
+    }
+  }
+}
+
+TEST_CASE("GetStreamSeed", "[default]") {
+  GIVEN("a world") {
+    emp::Random random(17);
+    SymConfigBase config;
+    SymWorld world(random, &config);
+    world.Resize(4);
+
+    THEN("stream seeds are positive and fixed by the stream and id") {
+      REQUIRE(world.GetStreamSeed(0, 5) > 0);
+      REQUIRE(world.GetStreamSeed(0, 5) == world.GetStreamSeed(0, 5));
+      REQUIRE(world.GetStreamSeed(0, 5) != world.GetStreamSeed(0, 6));
+      REQUIRE(world.GetStreamSeed(0, 5) != world.GetStreamSeed(1, 5));
+    }
+
+    WHEN("the world updates") {
+      int seed = world.GetStreamSeed(0, 5);
+      world.Update();
+
+      THEN("the stream seeds change") {
+        REQUIRE(world.GetStreamSeed(0, 5) != seed);
+      }
+    }
+  }
+}
+
+TEST_CASE("Counter-based random streams", "[default]") {
+  GIVEN("grid worlds with the same seed and counter-based random streams") {
+    size_t width = 40;
+    size_t height = 30;
+    int num_updates = 30;
+
+    SymConfigBase config;
+    config.GRID(1);
+    config.GRID_X(width);
+    config.GRID_Y(height);
+    config.POP_SIZE(200);
+    config.SYM_LIMIT(2);
+    config.HOST_REPRO_RES(200);
+    config.SYM_HORIZ_TRANS_RES(20);
+    config.COUNTER_RNG(1);
+
+    emp::vector<emp::vector<double>> host_int_vals;
+    for (int num_threads : {1, 3, 8}) {
+      config.THREADS(num_threads);
+      emp::Random random(17);
+      SymWorld world(random, &config);
+      world.Setup();
+      for (int i = 0; i < num_updates; i++) world.Update();
+
+      emp::vector<double> int_vals(width * height, -2);
+      for (size_t i = 0; i < world.GetSize(); i++) {
+        if (world.IsOccupied(i)) int_vals[i] = world.GetOrg(i).GetIntVal();
+      }
+      host_int_vals.push_back(int_vals);
+    }
+
+    THEN("a single thread gives the same results as several threads") {
+      REQUIRE(host_int_vals[0] == host_int_vals[1]);
+      REQUIRE(host_int_vals[0] == host_int_vals[2]);
+    }
+  }
+}
+
+TEST_CASE("Active cells", "[default]") {
+  GIVEN("a world") {
+    emp::Random random(17);
+    SymConfigBase config;
+    config.FREE_LIVING_SYMS(1);
+    SymWorld world(random, &config);
+    world.Resize(10);
+    REQUIRE(world.GetActiveCells().size() == 0);
+
+    WHEN("hosts and free-living symbionts are added") {
+      world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, 0.1), 2);
+      world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, 0.1), 5);
+      world.AddOrgAt(emp::NewPtr<Symbiont>(&random, &world, &config, 0.1), emp::WorldPosition(0, 5));
+      world.AddOrgAt(emp::NewPtr<Symbiont>(&random, &world, &config, 0.1), emp::WorldPosition(0, 7));
+
+      THEN("each occupied cell is listed once") {
+        emp::vector<size_t> active_cells = world.GetActiveCells();
+        std::sort(active_cells.begin(), active_cells.end());
+        REQUIRE(active_cells == emp::vector<size_t>({2, 5, 7}));
+      }
+
+      WHEN("organisms die or are extracted") {
+        world.DoDeath(2);
+        world.DoSymDeath(5);
+        emp::Ptr<Organism> sym = world.ExtractSym(7);
+        sym.Delete();
+
+        THEN("only cells that still hold an organism are listed") {
+          REQUIRE(world.GetActiveCells() == emp::vector<size_t>({5}));
+        }
+      }
+
+      WHEN("the world shrinks and grows") {
+        emp::Ptr<Organism> sym = world.ExtractSym(7);
+        sym.Delete();
+        world.Resize(6);
+        world.Resize(12);
+        world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, 0.1), 11);
+
+        THEN("cells cut off leave the list and new cells join it") {
+          emp::vector<size_t> active_cells = world.GetActiveCells();
+          std::sort(active_cells.begin(), active_cells.end());
+          REQUIRE(active_cells == emp::vector<size_t>({2, 5, 11}));
+        }
+      }
+    }
+  }
+
+  GIVEN("a sparse grid world that only visits occupied cells") {
+    emp::Random random(17);
+    SymConfigBase config;
+    config.GRID(1);
+    config.GRID_X(30);
+    config.GRID_Y(30);
+    config.POP_SIZE(20);
+    config.HOST_REPRO_RES(200);
+    config.SKIP_EMPTY_CELLS(1);
+    SymWorld world(random, &config);
+    world.Setup();
+
+    WHEN("the world updates") {
+      for (int i = 0; i < 30; i++) world.Update();
+
+      THEN("the hosts reproduce and the active cells match the occupied cells") {
+        size_t num_occupied = 0;
+        for (size_t i = 0; i < world.GetSize(); i++) {
+          if (world.IsOccupied(i) || world.GetSymAt(i)) num_occupied++;
+        }
+        REQUIRE(world.GetNumOrgs() > 40);
+        REQUIRE(world.GetActiveCells().size() == num_occupied);
+        for (size_t i : world.GetActiveCells()) {
+          REQUIRE((world.IsOccupied(i) || world.GetSymAt(i)));
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("ActiveCells", "[default]") {
+  GIVEN("a list tracking five cells") {
+    ActiveCells cells;
+    cells.Resize(5);
+
+    WHEN("cells are set active, set again, and set inactive") {
+      cells.Set(1, true);
+      cells.Set(3, true);
+      cells.Set(4, true);
+      cells.Set(3, true);
+      cells.Set(0, false);
+      cells.Set(1, false);
+
+      THEN("each active cell is listed once, with the last one moved into the gap") {
+        REQUIRE(cells.GetCells() == emp::vector<size_t>({4, 3}));
+        REQUIRE(cells.GetNumCells() == 5);
+      }
+    }
+  }
+}
+
+TEST_CASE("FillPermutation", "[default]") {
+  GIVEN("two random number generators with the same seed") {
+    emp::Random random(17);
+    emp::Random random_copy(17);
+
+    THEN("FillPermutation makes the same permutation as emp::GetPermutation") {
+      emp::vector<size_t> permutation;
+      for (size_t size : {1, 2, 10, 100}) {
+        SymWorld::FillPermutation(random, permutation, size);
+        REQUIRE(permutation == emp::GetPermutation(random_copy, size));
+      }
+    }
+  }
+}
+
+TEST_CASE("Schedule buffer", "[default]") {
+  GIVEN("a world") {
+    emp::Random random(17);
+    SymConfigBase config;
+    SymWorld world(random, &config);
+    size_t world_size = 20;
+    world.Resize(world_size);
+    for (size_t i = 0; i < world_size; i += 2) {
+      world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, 0.5), i);
+    }
+
+    WHEN("the world updates several times") {
+      world.Update();
+      const size_t * schedule_data = world.GetSchedule().data();
+      for (int i = 0; i < 10; i++) world.Update();
+
+      THEN("the schedule is refilled in place and visits every cell once") {
+        REQUIRE(world.GetSchedule().data() == schedule_data);
+        emp::vector<size_t> schedule = world.GetSchedule();
+        std::sort(schedule.begin(), schedule.end());
+        for (size_t i = 0; i < world_size; i++) REQUIRE(schedule[i] == i);
+      }
+    }
+
+    WHEN("only occupied cells are visited") {
+      config.SKIP_EMPTY_CELLS(1);
+      world.Update();
+      const size_t * schedule_data = world.GetSchedule().data();
+      for (int i = 0; i < 10; i++) world.Update();
+
+      THEN("the schedule reuses the same buffer") {
+        REQUIRE(world.GetSchedule().data() == schedule_data);
+        REQUIRE(world.GetSchedule().size() == world.GetActiveCells().size());
+      }
+    }
+  }
+}
+
+TEST_CASE("Synchronous updates", "[default]") {
+  GIVEN("a synchronous world with a host ready to reproduce") {
+    emp::Random random(17);
+    SymConfigBase config;
+    config.SYNCHRONOUS(1);
+    config.HOST_REPRO_RES(10);
+    config.RES_DISTRIBUTE(0);
+    SymWorld world(random, &config);
+    size_t world_size = 100;
+    world.Resize(world_size);
+    emp::Ptr<Host> host = emp::NewPtr<Host>(&random, &world, &config, 0.5);
+    host->SetPoints(20);
+    world.AddOrgAt(host, 0);
+
+    WHEN("the world updates") {
+      world.Update();
+
+      THEN("the offspring is placed at the end of the update without being processed") {
+        REQUIRE(world.GetNumOrgs() == 2);
+        REQUIRE(host->GetAge() == 1);
+        for (size_t i = 1; i < world_size; i++) {
+          if (world.IsOccupied(i)) REQUIRE(world.GetOrg(i).GetAge() == 0);
+        }
+      }
+    }
+  }
+
+  GIVEN("a synchronous world with a symbiont ready to reproduce") {
+    emp::Random random(17);
+    SymConfigBase config;
+    config.SYNCHRONOUS(1);
+    config.SYM_HORIZ_TRANS_RES(10);
+    config.HORIZ_TRANS(1);
+    config.HOST_REPRO_RES(10000);
+    config.SYM_LIMIT(2);
+    config.RES_DISTRIBUTE(0);
+    SymWorld world(random, &config);
+    world.Resize(2);
+    emp::Ptr<Host> host = emp::NewPtr<Host>(&random, &world, &config, 0.5);
+    emp::Ptr<Host> neighbor = emp::NewPtr<Host>(&random, &world, &config, 0.5);
+    emp::Ptr<Symbiont> sym = emp::NewPtr<Symbiont>(&random, &world, &config, 0.5);
+    sym->SetPoints(20);
+    host->AddSymbiont(sym);
+    world.AddOrgAt(host, 0);
+    world.AddOrgAt(neighbor, 1);
+
+    WHEN("the world updates") {
+      world.Update();
+
+      THEN("the offspring infects a host at the end of the update and counts as a success") {
+        size_t num_syms = host->GetSymbionts().size() + neighbor->GetSymbionts().size();
+        REQUIRE(num_syms == 2);
+        REQUIRE(world.GetHorizontalTransmissionAttemptCount().GetTotal() == 1);
+        REQUIRE(world.GetHorizontalTransmissionSuccessCount().GetTotal() == 1);
+      }
+    }
+  }
+
+  GIVEN("synchronous grid worlds with the same seed and counter-based random streams") {
+    size_t width = 40;
+    size_t height = 30;
+    int num_updates = 30;
+
+    SymConfigBase config;
+    config.GRID(1);
+    config.GRID_X(width);
+    config.GRID_Y(height);
+    config.POP_SIZE(200);
+    config.SYM_LIMIT(2);
+    config.HOST_REPRO_RES(200);
+    config.SYM_HORIZ_TRANS_RES(20);
+    config.COUNTER_RNG(1);
+    config.SYNCHRONOUS(1);
+
+    emp::vector<emp::vector<double>> host_int_vals;
+    for (int num_threads : {1, 4}) {
+      config.THREADS(num_threads);
+      emp::Random random(17);
+      SymWorld world(random, &config);
+      world.Setup();
+      for (int i = 0; i < num_updates; i++) world.Update();
+
+      emp::vector<double> int_vals(width * height, -2);
+      for (size_t i = 0; i < world.GetSize(); i++) {
+        if (world.IsOccupied(i)) int_vals[i] = world.GetOrg(i).GetIntVal();
+      }
+      host_int_vals.push_back(int_vals);
+    }
+
+    THEN("a single thread gives the same results as several threads") {
+      REQUIRE(host_int_vals[0] == host_int_vals[1]);
+    }
+  }
+}
+
+TEST_CASE("Event-driven updates", "[default]") {
+  GIVEN("a fixed-update world and an event-driven world, each with one host") {
+    int num_updates = 30;
+    SymConfigBase config;
+    config.RES_DISTRIBUTE(10);
+    config.HOST_REPRO_RES(1000);
+    config.DATA_INT(1000);
+
+    emp::Random random(17);
+    SymWorld world(random, &config);
+    world.Resize(10);
+    emp::Ptr<Host> host = emp::NewPtr<Host>(&random, &world, &config, 0);
+    world.AddOrgAt(host, 3);
+    for (int i = 0; i < num_updates; i++) world.Update();
+
+    config.EVENT_DRIVEN(1);
+    emp::Random event_random(17);
+    SymWorld event_world(event_random, &config);
+    event_world.Resize(10);
+    emp::Ptr<Host> event_host = emp::NewPtr<Host>(&event_random, &event_world, &config, 0);
+    event_world.AddOrgAt(event_host, 3);
+
+    WHEN("the host's gains are steady") {
+      for (int i = 0; i < num_updates; i++) event_world.Update();
+
+      THEN("the cell sleeps until the host can reproduce") {
+        REQUIRE(event_world.GetCellsProcessed() < (size_t) num_updates);
+        REQUIRE(event_world.GetCellWakeUpdate(3) == 100);
+        REQUIRE(event_world.GetCellWakeUpdate(4) == (size_t) -1);
+      }
+
+      THEN("the skipped updates are filled in when the world is brought up to date") {
+        event_world.CatchUpAllCells();
+        REQUIRE(event_host->GetPoints() == host->GetPoints());
+        REQUIRE(event_host->GetAge() == host->GetAge());
+      }
+    }
+
+    WHEN("another organism is placed in a sleeping cell") {
+      for (int i = 0; i < num_updates; i++) event_world.Update();
+      event_world.AddOrgAt(emp::NewPtr<Host>(&event_random, &event_world, &config, 0), 3);
+
+      THEN("the cell is processed in the next update") {
+        REQUIRE(event_world.GetCellWakeUpdate(3) == event_world.GetUpdate() + 1);
+      }
+    }
+
+    WHEN("the experiment is run") {
+      config.UPDATES(num_updates);
+      event_world.RunExperiment(false);
+
+      THEN("the host ends up as it would with fixed updates") {
+        REQUIRE(event_host->GetPoints() == host->GetPoints());
+        REQUIRE(event_host->GetAge() == host->GetAge());
+      }
+    }
+  }
+}
+
+TEST_CASE("Organism pool", "[default]") {
+  GIVEN("a world") {
+    emp::Random random(17);
+    SymConfigBase config;
+    SymWorld world(random, &config);
+    world.Resize(10);
+
+    WHEN("an organism dies and another is born") {
+      OrganismPool::Stats before = world.GetAllocationStats();
+      emp::Ptr<Host> host = emp::NewPtr<Host>(&random, &world, &config, 0.5);
+      void * slot = host.Raw();
+      world.AddOrgAt(host, 0);
+      world.DoDeath(0);
+      emp::Ptr<Host> baby = emp::NewPtr<Host>(&random, &world, &config, 0.5);
+      OrganismPool::Stats after = world.GetAllocationStats();
+
+      THEN("the new organism reuses the dead one's slot") {
+        REQUIRE((void *) baby.Raw() == slot);
+        REQUIRE(after.allocations == before.allocations + 2);
+        REQUIRE(after.recycled >= before.recycled + 1);
+        REQUIRE(after.live == before.live + 1);
+        REQUIRE(after.slab_slots >= after.live);
+        REQUIRE(after.GetOccupancy() > 0);
+        REQUIRE(after.GetRecycleRate() > 0);
+      }
+      baby.Delete();
+    }
+
+    WHEN("organisms of different types are made") {
+      emp::Ptr<Organism> host = emp::NewPtr<Host>(&random, &world, &config, 0.5);
+      emp::Ptr<Organism> sym = emp::NewPtr<Symbiont>(&random, &world, &config, 0.5);
+
+      THEN("they can be used and freed as before") {
+        REQUIRE(host->AddSymbiont(sym) == 1);
+        REQUIRE(host->GetSymbionts()[0]->GetIntVal() == 0.5);
+      }
+      host.Delete();
+    }
+  }
+
+  GIVEN("threaded grid worlds that are built, run and destroyed one after another") {
+    SymConfigBase config;
+    config.GRID(1);
+    config.GRID_X(40);
+    config.GRID_Y(30);
+    config.POP_SIZE(400);
+    config.START_MOI(1);
+    config.SYM_LIMIT(2);
+    config.HOST_REPRO_RES(200);
+    config.SYM_HORIZ_TRANS_RES(20);
+    config.FREE_LIVING_SYMS(1);
+    config.MOVE_FREE_SYMS(1);
+    config.THREADS(3);
+
+    size_t num_cycles = 8;
+    emp::vector<size_t> slab_slots;
+    size_t num_orgs = 0;
+    for (size_t cycle = 0; cycle < num_cycles; cycle++) {
+      {
+        emp::Random random(17);
+        SymWorld world(random, &config);
+        world.Setup();
+        for (int i = 0; i < 20; i++) world.Update();
+        num_orgs = world.GetNumOrgs();
+      }
+      slab_slots.push_back(OrganismPool::GetStats().slab_slots);
+    }
+
+    THEN("the organisms freed by one world's threads are reused by the next, so the slabs stop growing") {
+      //each world freeing its organisms into a cache no other thread could reach cost about a world's worth of slots
+      REQUIRE(num_orgs > 1000);
+      REQUIRE(slab_slots[num_cycles - 1] - slab_slots[num_cycles / 2] < num_orgs);
+    }
+  }
+}
+
+TEST_CASE("Statically typed world", "[default]") {
+  GIVEN("a world and a statically typed world with the same seed and settings") {
+    SymConfigBase config;
+    config.GRID_X(10);
+    config.GRID_Y(10);
+    config.POP_SIZE(60);
+    config.START_MOI(1);
+    config.HOST_INT(-2);
+    config.SYM_INT(-2);
+    config.SYM_LIMIT(3);
+    config.MUTATION_SIZE(0.05);
+    config.HOST_REPRO_RES(300);
+    config.SYM_HORIZ_TRANS_RES(50);
+    config.FREE_LIVING_SYMS(1);
+    config.FREE_SYM_RES_DISTRIBUTE(20);
+    config.DATA_INT(1000);
+
+    emp::Random random(31);
+    SymWorld world(random, &config);
+    world.Setup();
+    emp::Random typed_random(31);
+    SymWorldT<SymWorld, Host, Symbiont> typed_world(typed_random, &config);
+    typed_world.Setup();
+
+    WHEN("both are run") {
+      for (int i = 0; i < 60; i++) {
+        world.Update();
+        typed_world.Update();
+      }
+
+      THEN("they hold the same organisms") {
+        REQUIRE(typed_world.GetNumOrgs() == world.GetNumOrgs());
+        for (size_t i = 0; i < world.GetSize(); i++) {
+          REQUIRE(typed_world.IsOccupied(i) == world.IsOccupied(i));
+          REQUIRE((bool) typed_world.GetSymAt(i) == (bool) world.GetSymAt(i));
+          if (world.GetSymAt(i)) REQUIRE(typed_world.GetSymAt(i)->GetIntVal() == world.GetSymAt(i)->GetIntVal());
+          if (!world.IsOccupied(i)) continue;
+          REQUIRE(typed_world.GetOrg(i).GetIntVal() == world.GetOrg(i).GetIntVal());
+          REQUIRE(typed_world.GetOrg(i).GetPoints() == world.GetOrg(i).GetPoints());
+          REQUIRE(typed_world.GetOrg(i).GetSymbionts().size() == world.GetOrg(i).GetSymbionts().size());
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("Config snapshot", "[default]") {
+  GIVEN("a statically typed world that has been set up") {
+    SymConfigBase config;
+    config.GRID_X(10);
+    config.GRID_Y(10);
+    config.POP_SIZE(60);
+    config.HOST_INT(-2);
+    config.SYM_INT(-2);
+    config.HORIZ_TRANS(0);
+    config.ECTOSYMBIOSIS(1);
+    config.FREE_LIVING_SYMS(1);
+    config.FREE_SYM_RES_DISTRIBUTE(20);
+    config.HOST_REPRO_RES(300);
+    config.DATA_INT(1000);
+
+    emp::Random random(37);
+    SymWorld world(random, &config);
+    world.Setup();
+    emp::Random typed_random(37);
+    SymWorldT<SymWorld, Host, Symbiont> typed_world(typed_random, &config);
+    typed_world.Setup();
+
+    THEN("its snapshot holds the settings") {
+      const ConfigSnapshot & snapshot = typed_world.GetConfigSnapshot();
+      REQUIRE(snapshot.free_living_syms == true);
+      REQUIRE(snapshot.ectosymbiosis == true);
+      REQUIRE(snapshot.horiz_trans == false);
+      REQUIRE(snapshot.host_repro_res == 300);
+    }
+
+    WHEN("it is run with some features switched off") {
+      for (int i = 0; i < 40; i++) {
+        world.Update();
+        typed_world.Update();
+      }
+      THEN("it gives the same results as a world reading the config") {
+        REQUIRE(typed_world.GetNumOrgs() == world.GetNumOrgs());
+        for (size_t i = 0; i < world.GetSize(); i++) {
+          REQUIRE(typed_world.IsOccupied(i) == world.IsOccupied(i));
+          REQUIRE((bool) typed_world.GetSymAt(i) == (bool) world.GetSymAt(i));
+          if (!world.IsOccupied(i)) continue;
+          REQUIRE(typed_world.GetOrg(i).GetPoints() == world.GetOrg(i).GetPoints());
+        }
+      }
+    }
+
+    WHEN("mutation is turned off") {
+      config.HOST_REPRO_RES(500);
+      typed_world.SetMutationZero();
+      THEN("the snapshot is retaken") {
+        REQUIRE(typed_world.GetConfigSnapshot().host_repro_res == 500);
+        REQUIRE(config.MUTATION_RATE() == 0);
+      }
+    }
+  }
+}
+
+TEST_CASE("Free-living layer", "[default]") {
+  GIVEN("a world set up without free-living symbionts") {
+    emp::Random random(17);
+    SymConfigBase config;
+    config.FREE_LIVING_SYMS(0);
+    config.GRID_X(10);
+    config.GRID_Y(10);
+    config.UPDATES(20);
+    SymWorld world(random, &config);
+    world.Setup();
+
+    THEN("it has no free-living layer") {
+      REQUIRE(world.HasFreeLivingLayer() == false);
+      REQUIRE(world.GetSymPop().size() == 0);
+      REQUIRE(world.GetSymAt(0) == nullptr);
+      REQUIRE(world.IsInboundsPos(emp::WorldPosition(0, 5)) == true);
+    }
+
+    WHEN("it is run") {
+      world.RunExperiment(false);
+      THEN("the layer stays out and the symbiont counts come from the hosts") {
+        REQUIRE(world.HasFreeLivingLayer() == false);
+        REQUIRE(world.GetCountFreeSymsDataNode().GetTotal() == 0);
+        REQUIRE(world.GetSymCountDataNode().GetTotal() == world.GetCountHostedSymsDataNode().GetTotal());
+      }
+    }
+
+    WHEN("a symbiont is placed in a cell") {
+      emp::Ptr<Organism> sym = emp::NewPtr<Symbiont>(&random, &world, &config, 0);
+      world.AddOrgAt(sym, emp::WorldPosition(0, 5));
+      THEN("the layer is brought back") {
+        REQUIRE(world.HasFreeLivingLayer() == true);
+        REQUIRE(world.GetSymPop().size() == world.GetPop().size());
+        REQUIRE(world.GetSymAt(5) == sym);
+      }
+    }
+  }
+
+  GIVEN("a world set up with free-living symbionts") {
+    emp::Random random(17);
+    SymConfigBase config;
+    config.FREE_LIVING_SYMS(1);
+    config.GRID_X(10);
+    config.GRID_Y(10);
+    SymWorld world(random, &config);
+    world.Setup();
+
+    THEN("it has a free-living layer the size of the world") {
+      REQUIRE(world.HasFreeLivingLayer() == true);
+      REQUIRE(world.GetSymPop().size() == world.GetPop().size());
+    }
+  }
+
+  GIVEN("a world where few cells hold a free-living symbiont") {
+    emp::Random random(17);
+    SymConfigBase config;
+    config.FREE_LIVING_SYMS(1);
+    config.GRID_X(10);
+    config.GRID_Y(10);
+    SymWorld world(random, &config);
+    world.Resize(100);
+    emp::Ptr<Organism> sym = emp::NewPtr<Symbiont>(&random, &world, &config, 0);
+    world.AddOrgAt(sym, emp::WorldPosition(0, 42));
+    world.Update();
+
+    THEN("the layer becomes sparse and still finds the symbiont") {
+      REQUIRE(world.GetFreeSymLayer().IsSparse() == true);
+      REQUIRE(world.GetFreeSymLayer().GetCount() == 1);
+      size_t sym_cell = world.GetFreeSymLayer().GetOccupiedCells()[0];
+      REQUIRE(world.GetSymAt(sym_cell) != nullptr);
+      REQUIRE(world.GetSymPop()[sym_cell] == world.GetSymAt(sym_cell));
+    }
+  }
+}
+
+TEST_CASE("FreeSymLayer", "[default]") {
+  emp::Random random(17);
+  SymConfigBase config;
+  SymWorld world(random, &config);
+  emp::Ptr<Organism> sym1 = emp::NewPtr<Symbiont>(&random, &world, &config, 0);
+  emp::Ptr<Organism> sym2 = emp::NewPtr<Symbiont>(&random, &world, &config, 0);
+
+  FreeSymLayer layer;
+  layer.resize(50);
+  layer.Set(30, sym1);
+  layer.Set(7, sym2);
+
+  WHEN("the layer is dense") {
+    THEN("it holds the symbionts in their cells") {
+      REQUIRE(layer.IsSparse() == false);
+      REQUIRE(layer.GetCount() == 2);
+      REQUIRE(layer[30] == sym1);
+      REQUIRE(layer[7] == sym2);
+      REQUIRE(layer[8] == nullptr);
+      REQUIRE(layer.GetOccupiedCells() == emp::vector<size_t>{7, 30});
+    }
+  }
+
+  WHEN("the layer is made sparse") {
+    layer.SetSparse(true);
+    THEN("it holds the same symbionts in the same order") {
+      REQUIRE(layer.IsSparse() == true);
+      REQUIRE(layer.GetCount() == 2);
+      REQUIRE(layer[30] == sym1);
+      REQUIRE(layer.Has(8) == false);
+      REQUIRE(layer.GetOccupiedCells() == emp::vector<size_t>{7, 30});
+    }
+
+    layer.Set(30, nullptr);
+    layer.Set(49, sym1);
+    THEN("cells can be emptied and filled") {
+      REQUIRE(layer.GetCount() == 2);
+      REQUIRE(layer.Has(30) == false);
+      REQUIRE(layer.GetOccupiedCells() == emp::vector<size_t>{7, 49});
+    }
+
+    layer.resize(20);
+    THEN("resizing cuts off the symbionts past the end") {
+      REQUIRE(layer.GetCount() == 1);
+      REQUIRE(layer.size() == 20);
+    }
+
+    layer.SetSparse(false);
+    THEN("it can be made dense again") {
+      REQUIRE(layer.IsSparse() == false);
+      REQUIRE(layer[7] == sym2);
+    }
+  }
+
+  WHEN("the form is chosen by density") {
+    layer.ChooseForm(true);
+    THEN("a layer with few symbionts becomes sparse") {
+      REQUIRE(layer.IsSparse() == true);
+    }
+    layer.ChooseForm(false);
+    THEN("it stays dense when sparse isn't allowed") {
+      REQUIRE(layer.IsSparse() == false);
+    }
+  }
+
+  sym1.Delete();
+  sym2.Delete();
+}
+
+TEST_CASE("Memory report", "[default]") {
+  GIVEN("a world with hosts and free-living symbionts") {
+    emp::Random random(17);
+    SymConfigBase config;
+    config.FREE_LIVING_SYMS(1);
+    config.GRID_X(10);
+    config.GRID_Y(10);
+    config.START_MOI(0);
+    config.SYM_LIMIT(10);
+    SymWorld world(random, &config);
+    world.Setup();
+
+    for (size_t i = 0; i < 5; i++) {
+      world.GetOrg(i).AddSymbiont(emp::NewPtr<Symbiont>(&random, &world, &config, 0.5));
+    }
+    for (size_t i = 0; i < 6; i++) {
+      world.GetOrg(10).AddSymbiont(emp::NewPtr<Symbiont>(&random, &world, &config, 0.5));
+    }
+    world.AddOrgAt(emp::NewPtr<Symbiont>(&random, &world, &config, 0.5), emp::WorldPosition(0, 20));
+    world.GetHostCountDataNode();
+    world.GetHostIntValDataNode();
+
+    MemoryReport report = world.GetMemoryReport();
+
+    THEN("it accounts for the organisms by type") {
+      REQUIRE(report.GetCount("Host") == 100);
+      REQUIRE(report.GetBytes("Host") == 100 * sizeof(Host));
+      REQUIRE(report.GetCount("Symbiont") == 12);
+      REQUIRE(report.GetBytes("Symbiont") == 12 * sizeof(Symbiont));
+    }
+    THEN("it accounts for the population vectors") {
+      REQUIRE(report.GetCount("pop") == 100);
+      REQUIRE(report.GetBytes("pop") >= 100 * sizeof(emp::Ptr<Organism>));
+      REQUIRE(report.GetCount("sym_pop") == 1);
+      REQUIRE(report.GetBytes("sym_pop") == world.GetFreeSymLayer().GetBytes());
+    }
+    THEN("only symbiont lists that outgrew their host take up more memory") {
+      REQUIRE(report.GetCount("symbiont_lists") == 1);
+      REQUIRE(report.GetBytes("symbiont_lists") == world.GetOrg(10).GetSymbionts().GetHeapBytes());
+      REQUIRE(report.GetBytes("symbiont_lists") >= 6 * sizeof(emp::Ptr<Organism>));
+    }
+    THEN("it accounts for the data monitors that have been made, and no phylogenies") {
+      REQUIRE(report.GetCount("data_monitors") == 2);
+      REQUIRE(report.GetBytes("data_monitors") >= sizeof(emp::DataMonitor<int>) + sizeof(emp::DataMonitor<double, emp::data::Histogram>));
+      REQUIRE(report.GetCount("host_sys") == 0);
+    }
+    THEN("it is written as a row per structure and a total") {
+      std::stringstream out;
+      report.Write(out, 3);
+      emp::vector<std::string> rows;
+      std::string line;
+      while (std::getline(out, line)) rows.push_back(line);
+      REQUIRE(rows.size() == report.GetEntries().size() + 1);
+      REQUIRE(rows.back() == "3,total,," + std::to_string(report.GetTotalBytes()));
+    }
+  }
+
+  GIVEN("a world keeping phylogenies") {
+    emp::Random random(17);
+    SymConfigBase config;
+    config.PHYLOGENY(1);
+    config.GRID_X(5);
+    config.GRID_Y(5);
+    SymWorld world(random, &config);
+    world.Setup();
+
+    MemoryReport report = world.GetMemoryReport();
+
+    THEN("it accounts for their taxa") {
+      REQUIRE(report.GetCount("host_sys") >= 1);
+      REQUIRE(report.GetCount("sym_sys") >= 1);
+      REQUIRE(report.GetBytes("host_sys") > report.GetCount("host_sys") * sizeof(emp::Taxon<int>));
+    }
+  }
+}
+
+TEST_CASE("Memory policy", "[default]") {
+  GIVEN("a huge page policy") {
+    MemoryPolicy::Set(MemoryPolicy::HUGE_PAGES_EXPLICIT, MemoryPolicy::NUMA_INTERLEAVE);
+
+    THEN("slabs are carved out of chunks, falling back when no huge pages are reserved") {
+      size_t chunks = MemoryPolicy::GetExplicitChunks() + MemoryPolicy::GetOtherChunks();
+      char * slab = (char *) MemoryPolicy::AllocateSlab(MemoryPolicy::CHUNK_SIZE);
+      char * next = (char *) MemoryPolicy::AllocateSlab(1000);
+      REQUIRE(MemoryPolicy::GetExplicitChunks() + MemoryPolicy::GetOtherChunks() == chunks + 2);
+      REQUIRE((size_t) slab % MemoryPolicy::HUGE_PAGE_SIZE == 0);
+      REQUIRE((size_t) next % 64 == 0);
+      slab[0] = 1;
+      next[999] = 1;
+    }
+
+    THEN("vectors are grown ahead of being filled in") {
+      emp::vector<size_t> vec;
+      MemoryPolicy::Reserve(vec, 100000);
+      REQUIRE(vec.capacity() >= 100000);
+      vec.resize(100000, 3);
+      REQUIRE(vec[99999] == 3);
+    }
+  }
+
+  GIVEN("worlds run with and without a policy") {
+    emp::vector<int> host_counts;
+    for (int huge_pages : {0, 1}) {
+      emp::Random random(5);
+      SymConfigBase config;
+      config.HUGE_PAGES(huge_pages);
+      config.NUMA_POLICY(huge_pages);
+      config.GRID(1);
+      config.GRID_X(20);
+      config.GRID_Y(20);
+      config.FREE_LIVING_SYMS(1);
+      config.UPDATES(30);
+      SymWorld world(random, &config);
+      world.Setup();
+      world.RunExperiment(false);
+      host_counts.push_back(world.GetNumOrgs());
+    }
+
+    THEN("the policy doesn't change the results") {
+      REQUIRE(host_counts[0] == host_counts[1]);
+    }
+  }
+
+  MemoryPolicy::Set(MemoryPolicy::HUGE_PAGES_OFF, MemoryPolicy::NUMA_FIRST_TOUCH);
+}
+
+TEST_CASE("Grid world setup", "[default]") {
+  GIVEN("a grid world filled by Setup") {
+    emp::Random random(53);
+    SymConfigBase config;
+    config.GRID(1);
+    config.GRID_X(20);
+    config.GRID_Y(20);
+    SymWorld world(random, &config);
+    world.Setup();
+
+    THEN("hosts are injected across the whole grid") {
+      //each of the 400 hosts lands in a random cell, so about 1 - 1/e of
+      //the cells end up holding one
+      REQUIRE(world.GetSize() == 400);
+      REQUIRE(world.GetNumOrgs() > 200);
+      size_t last_rows = 0;
+      for (size_t i = 300; i < 400; i++) last_rows += world.IsOccupied(i);
+      REQUIRE(last_rows > 40);
+    }
+  }
+}
@@ -771,3 +771,33 @@ TEST_CASE("Symbiont MakeNew", "[default]"){
     sym1.Delete();
     sym2.Delete();
 }
+
+TEST_CASE("Fixed16 trait storage", "[default]"){
+    WHEN("A value between -1 and 1 is stored"){
+        Fixed16Trait trait = 0.3;
+        THEN("It reads back to within half a step"){
+            REQUIRE(std::abs((double) trait - 0.3) <= 0.5 / 32767);
+        }
+    }
+    WHEN("The ends of the range and zero are stored"){
+        Fixed16Trait high = 1;
+        Fixed16Trait low = -1;
+        Fixed16Trait zero = 0;
+        THEN("They read back exactly"){
+            REQUIRE((double) high == 1);
+            REQUIRE((double) low == -1);
+            REQUIRE((double) zero == 0);
+        }
+    }
+    WHEN("A value is pushed outside the range by a mutation"){
+        Fixed16Trait trait = 0.999;
+        trait += 0.01;
+        THEN("It is clamped to the edge of the range"){
+            REQUIRE((double) trait == 1);
+        }
+        trait -= 2.5;
+        THEN("It is clamped at the other edge too"){
+            REQUIRE((double) trait == -1);
+        }
+    }
+}
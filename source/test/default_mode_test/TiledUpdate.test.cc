@@ -0,0 +1,64 @@
+#include "../../default_mode/TiledUpdate.h"
+#include <set>
+
+TEST_CASE("GetTileBounds", "[default]") {
+  GIVEN("grid axes of different lengths") {
+    THEN("each axis is split into one tile or an even number of tiles at least two cells wide") {
+      for (size_t length = 1; length < 100; length++) {
+        emp::vector<size_t> bounds = TiledUpdate::GetTileBounds(length);
+        size_t num_tiles = bounds.size() - 1;
+        REQUIRE((num_tiles == 1 || num_tiles % 2 == 0));
+        REQUIRE(bounds[0] == 0);
+        REQUIRE(bounds[num_tiles] == length);
+        if (num_tiles > 1) {
+          for (size_t i = 0; i < num_tiles; i++) REQUIRE(bounds[i + 1] - bounds[i] >= 2);
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("WorkerPool", "[default]") {
+  GIVEN("a worker pool") {
+    WorkerPool pool;
+    REQUIRE(pool.GetNumWorkers() == 0);
+
+    WHEN("jobs are run on one thread") {
+      std::thread::id caller;
+      pool.Run(1, [&caller]() { caller = std::this_thread::get_id(); });
+
+      THEN("they run on the calling thread and no workers are started") {
+        REQUIRE(caller == std::this_thread::get_id());
+        REQUIRE(pool.GetNumWorkers() == 0);
+      }
+    }
+
+    WHEN("jobs are run on several threads, round after round") {
+      std::mutex mutex;
+      emp::vector<std::set<std::thread::id>> ids_by_round;
+      emp::vector<std::set<size_t>> rounds_seen_by_round;
+      for (size_t round = 0; round < 20; round++) {
+        std::set<std::thread::id> ids;
+        std::set<size_t> rounds_seen_set;
+        pool.Run(4, [&mutex, &ids, &rounds_seen_set]() {
+          static thread_local size_t rounds_seen = 0;
+          rounds_seen++;
+          std::unique_lock<std::mutex> lock(mutex);
+          ids.insert(std::this_thread::get_id());
+          rounds_seen_set.insert(rounds_seen);
+        });
+        ids_by_round.push_back(ids);
+        rounds_seen_by_round.push_back(rounds_seen_set);
+      }
+
+      THEN("every round runs on the same threads, which keep their thread_local state") {
+        REQUIRE(pool.GetNumWorkers() == 3);
+        for (size_t round = 0; round < 20; round++) {
+          REQUIRE(ids_by_round[round].size() == 4);
+          REQUIRE(ids_by_round[round] == ids_by_round[0]);
+          REQUIRE(rounds_seen_by_round[round] == std::set<size_t>{round + 1});
+        }
+      }
+    }
+  }
+}
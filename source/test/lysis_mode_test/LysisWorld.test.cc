@@ -112,3 +112,76 @@ TEST_CASE("Lysis SetupHosts", "[lysis]") {
     }
   }
 }
+
+TEST_CASE("Lysis event-driven updates", "[lysis]") {
+  GIVEN("an event-driven world with a bacterium carrying a lysogenic phage") {
+    emp::Random random(17);
+    SymConfigBase config;
+    config.LYSIS(1);
+    config.LYSIS_CHANCE(0);
+    config.CHANCE_OF_INDUCTION(0.05);
+    config.BURST_TIME(100000);
+    config.HOST_REPRO_RES(100000);
+    config.RES_DISTRIBUTE(10);
+    config.FREE_LIVING_SYMS(0);
+    config.EVENT_DRIVEN(1);
+
+    LysisWorld world(random, &config);
+    world.Resize(4);
+    emp::Ptr<Bacterium> bacterium = emp::NewPtr<Bacterium>(&random, &world, &config, 0);
+    emp::Ptr<Phage> phage = emp::NewPtr<Phage>(&random, &world, &config, 0);
+    bacterium->AddSymbiont(phage);
+    world.AddOrgAt(bacterium, 0);
+    REQUIRE(phage->GetLysogeny() == true);
+
+    WHEN("the world runs long enough for the phage to be induced") {
+      for (int i = 0; i < 300; i++) world.Update();
+      world.CatchUpAllCells();
+
+      THEN("the phage has become lytic and the bacterium has kept aging") {
+        REQUIRE(phage->GetLysogeny() == false);
+        REQUIRE(bacterium->GetAge() == 300);
+      }
+    }
+  }
+}
+
+TEST_CASE("Lysis population counts", "[lysis]") {
+  GIVEN("a world of bacteria with lytic and lysogenic phage") {
+    emp::Random random(41);
+    SymConfigBase config;
+    config.LYSIS(1);
+    config.LYSIS_CHANCE(0.5);
+    config.CHANCE_OF_INDUCTION(0.1);
+    config.PROPHAGE_LOSS_RATE(0.05);
+    config.BURST_TIME(3);
+    config.FREE_LIVING_SYMS(1);
+    config.SYM_LIMIT(3);
+    config.GRID_X(10);
+    config.GRID_Y(10);
+    LysisWorld world(random, &config);
+    world.Setup();
+    emp::DataMonitor<int> & cfu_node = world.GetCFUDataNode();
+
+    WHEN("phage switch between lysis and lysogeny, burst and are lost") {
+      THEN("the counts and the CFU count follow") {
+        for (int i = 0; i < 30; i++) {
+          world.Update();
+          REQUIRE(world.CountsMatchPopulation());
+
+          int cfu = 0;
+          for (size_t j = 0; j < world.GetPop().size(); j++) {
+            if (!world.IsOccupied(j)) continue;
+            bool all_lysogenic = true;
+            for (emp::Ptr<Organism> sym : world.GetOrg(j).GetSymbionts()) {
+              if (!sym->GetLysogeny()) all_lysogenic = false;
+            }
+            if (all_lysogenic) cfu++;
+          }
+          world.CollectStats();
+          REQUIRE(cfu_node.GetTotal() == cfu);
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,56 @@
+#a script to time the memory policies (HUGE_PAGES and NUMA_POLICY) at several grid sizes
+#BUILD THE EXECUTABLE FIRST WITH: make default-mode
+#EX: INSIDE OF SymbulationEmp, RUN python3 stats_scripts/alloc_policy.py [updates] [threads] [grid sizes...]
+#Each policy is run on the same seeds with SymSettings.cfg on a square grid of each size. The script
+#prints the median run time of each policy at each size, and its speedup over the default policy.
+#Interleaving only makes a difference on machines with more than one NUMA node.
+import os
+import shutil
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+policies = [("default", 0, 0), ("transparent", 1, 0), ("explicit", 2, 0),
+            ("interleave", 0, 1), ("transparent+interleave", 1, 1)]
+seeds = range(1, 4)
+
+updates = 10
+threads = 1
+sizes = [250, 500, 1000]
+
+if(len(sys.argv) > 1):
+    updates = int(sys.argv[1])
+if(len(sys.argv) > 2):
+    threads = int(sys.argv[2])
+if(len(sys.argv) > 3):
+    sizes = [int(size) for size in sys.argv[3:]]
+
+build = os.path.join(os.getcwd(), "symbulation_default")
+if not os.path.exists(build):
+    print("Missing symbulation_default - build it with: make default-mode")
+    sys.exit(1)
+
+def run_time(size, huge_pages, numa, seed):
+    '''Returns the time it takes to run one world with the given policy.'''
+    run_dir = tempfile.mkdtemp()
+    shutil.copy("SymSettings.cfg", run_dir)
+    start = time.time()
+    subprocess.run([build, "-SEED", str(seed), "-GRID", "1", "-GRID_X", str(size), "-GRID_Y", str(size),
+                    "-UPDATES", str(updates), "-DATA_INT", str(updates), "-THREADS", str(threads),
+                    "-HUGE_PAGES", str(huge_pages), "-NUMA_POLICY", str(numa), "-FILE_NAME", "_alloc"],
+                   cwd=run_dir, stdout=subprocess.DEVNULL, check=True)
+    elapsed = time.time() - start
+    shutil.rmtree(run_dir)
+    return elapsed
+
+print("Running", updates, "updates on", threads, "thread(s) with seeds", seeds.start, "up to", seeds.stop)
+for size in sizes:
+    baseline = None
+    for name, huge_pages, numa in policies:
+        median = statistics.median([run_time(size, huge_pages, numa, seed) for seed in seeds])
+        if baseline is None:
+            baseline = median
+        print(str(size) + "x" + str(size), name.ljust(24), "time " + format(median, ".3f") + "s",
+              "speedup " + format(baseline / median, ".2f"), flush=True)
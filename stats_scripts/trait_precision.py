@@ -0,0 +1,71 @@
+#a script to compare the reduced-precision trait builds against the double build
+#BUILD THE EXECUTABLES FIRST WITH: make default-mode precision-modes
+#EX: INSIDE OF SymbulationEmp, RUN python3 stats_scripts/trait_precision.py [first seed] [last seed]
+#Each build is run on the same seeds with SymSettings.cfg. For each build the script prints
+#its mean run time and the mean final host and symbiont interaction values, and for the
+#reduced-precision builds the Welch t statistic of their final values against the double
+#build's. A |t| above 3 means the build's results differ from the double build's.
+import os
+import shutil
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+builds = ["symbulation_default", "symbulation_default_float", "symbulation_default_fixed16"]
+files = ["HostVals", "SymVals"]
+
+start_range = 1
+end_range = 11
+
+if(len(sys.argv) > 1):
+    start_range = int(sys.argv[1])
+    end_range = int(sys.argv[2])
+
+seeds = range(start_range, end_range)
+
+def final_mean_intval(filename):
+    '''Returns the mean_intval column of the last row of a data file.'''
+    with open(filename) as data:
+        lines = [line for line in data.read().split("\n") if line]
+    column = lines[0].split(",").index("mean_intval")
+    return float(lines[-1].split(",")[column])
+
+def welch_t(a, b):
+    '''Returns Welch's t statistic for the difference between the means of a and b.'''
+    se = (statistics.variance(a) / len(a) + statistics.variance(b) / len(b)) ** 0.5
+    if se == 0:
+        return 0.0 if statistics.mean(a) == statistics.mean(b) else float("inf")
+    return (statistics.mean(a) - statistics.mean(b)) / se
+
+root = os.getcwd()
+results = {}
+for build in builds:
+    if not os.path.exists(build):
+        print("Missing", build, "- build it with: make default-mode precision-modes")
+        sys.exit(1)
+    times = []
+    finals = {name: [] for name in files}
+    for seed in seeds:
+        run_dir = tempfile.mkdtemp()
+        shutil.copy("SymSettings.cfg", run_dir)
+        start = time.time()
+        subprocess.run([os.path.join(root, build), "-SEED", str(seed), "-FILE_NAME", "_precision"],
+                       cwd=run_dir, stdout=subprocess.DEVNULL, check=True)
+        times.append(time.time() - start)
+        for name in files:
+            finals[name].append(final_mean_intval(os.path.join(run_dir, name + "_precision_SEED" + str(seed) + ".data")))
+        shutil.rmtree(run_dir)
+    results[build] = (times, finals)
+
+print("Using seeds", start_range, "up to", end_range)
+baseline = results[builds[0]][1]
+for build in builds:
+    times, finals = results[build]
+    line = build.ljust(30) + " time " + format(statistics.mean(times), ".3f") + "s"
+    for name in files:
+        line += "  " + name + " " + format(statistics.mean(finals[name]), ".4f")
+        if build != builds[0] and len(seeds) > 1:
+            line += " (t " + format(welch_t(finals[name], baseline[name]), ".2f") + ")"
+    print(line)